@@ -1,8 +1,36 @@
 #include "ArtistManagerSubsystem.h"
 
 #include "Engine/Engine.h"
+#include "GameThreadCommandQueue.h"
 #include "GameTimeSubsystem.h"
+#include "MusicManagerStats.h"
 #include "MusicSaveGame.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "SimulationModels.h"
+#include "Tasks/Task.h"
+
+DECLARE_CYCLE_STAT(TEXT("Contracts AdvanceMonth"), STAT_ContractsAdvanceMonth, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Contracts StepMonth"), STAT_ContractsStepMonth, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Contracts"), STAT_ActiveContracts, STATGROUP_MusicSimulation);
+
+namespace
+{
+    /** Lifetime revenue figures that make the news when a contract passes them. */
+    constexpr float RevenueMilestones[] = { 100000.f, 250000.f, 500000.f, 1000000.f, 2500000.f, 5000000.f, 10000000.f };
+
+    /** Index of the highest milestone in (Before, After], or INDEX_NONE. */
+    int32 FindRevenueMilestoneCrossed(float Before, float After)
+    {
+        for (int32 MilestoneIndex = UE_ARRAY_COUNT(RevenueMilestones) - 1; MilestoneIndex >= 0; --MilestoneIndex)
+        {
+            if (Before < RevenueMilestones[MilestoneIndex] && After >= RevenueMilestones[MilestoneIndex])
+            {
+                return MilestoneIndex;
+            }
+        }
+        return INDEX_NONE;
+    }
+}
 
 void UArtistManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -10,15 +38,38 @@ void UArtistManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
     ActiveContracts.Reset();
     ExpiredContracts.Reset();
+    ContractExpiryEvents.Reset();
+    SimContracts.Reset();
+    SimContractResults.Reset();
 
+    Collection.InitializeDependency<UGameCalendarSubsystem>();
+
+    if (UGameTimeSubsystem* TimeSubsystem = Collection.InitializeDependency<UGameTimeSubsystem>())
+    {
+        MonthStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::Contracts, TEXT("Contracts"),
+            FMonthStageDelegate::CreateUObject(this, &UArtistManagerSubsystem::StepMonth), EMonthStageThread::Worker);
+        PublishStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::News, TEXT("ContractsPublish"),
+            FMonthStageDelegate::CreateUObject(this, &UArtistManagerSubsystem::PublishMonth));
+        MonthBegunHandle = TimeSubsystem->OnMonthBegun.AddUObject(this, &UArtistManagerSubsystem::HandleMonthBegun);
+        CurrentMonth = TimeSubsystem->GetCurrentMonth();
+    }
+}
+
+void UArtistManagerSubsystem::Deinitialize()
+{
     if (UGameInstance* GameInstance = GetGameInstance())
     {
         if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
         {
-            TimeSubsystem->OnMonthAdvanced.AddDynamic(this, &UArtistManagerSubsystem::HandleMonthAdvanced);
-            CurrentGameDate = TimeSubsystem->GetCurrentGameDate();
+            TimeSubsystem->UnregisterMonthStage(MonthStageHandle);
+            TimeSubsystem->UnregisterMonthStage(PublishStageHandle);
+            TimeSubsystem->OnMonthBegun.Remove(MonthBegunHandle);
         }
     }
+
+    Commands.Reset();
+
+    Super::Deinitialize();
 }
 
 void UArtistManagerSubsystem::SignArtist(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo)
@@ -28,12 +79,8 @@ void UArtistManagerSubsystem::SignArtist(const FArtistDealTerms& Deal, const FAr
     NewContract.ArtistData = ArtistInfo;
     NewContract.Terms = Deal;
 
-    const FDateTime EffectiveStartDate = Deal.ProposedStartDate.GetTicks() > 0 ? Deal.ProposedStartDate : CurrentGameDate;
-    NewContract.StartDate = EffectiveStartDate;
-
-    const int32 ContractMonths = CalculateContractDurationMonths(Deal);
-    const double DaysPerMonth = 30.0;
-    NewContract.EndDate = EffectiveStartDate + FTimespan::FromDays(ContractMonths * DaysPerMonth);
+    NewContract.StartMonth = Deal.ProposedStartMonth.IsValid() ? Deal.ProposedStartMonth : CurrentMonth;
+    NewContract.EndMonth = NewContract.StartMonth + CalculateContractDurationMonths(Deal);
 
     NewContract.bContractActive = true;
     NewContract.RecordsDelivered = 0;
@@ -41,15 +88,23 @@ void UArtistManagerSubsystem::SignArtist(const FArtistDealTerms& Deal, const FAr
     NewContract.LifetimeCost = Deal.SignUpBonus;
     NewContract.LastRoyaltyPayment = 0.f;
     NewContract.CumulativeRoyaltyPaid = 0.f;
-    NewContract.MonthlyUpkeepCost = 2000.f + ArtistInfo.PerformanceScore * 25.f;
+    NewContract.MonthlyUpkeepCost = MusicSimulation::GetMonthlyUpkeepCost(ArtistInfo);
     NewContract.PerformanceMomentum = ArtistInfo.PerformanceScore;
     NewContract.ProductionProgress = 0.f;
     NewContract.MonthsActive = 0;
 
-    ActiveContracts.Add(NewContract);
-
-    OnArtistSigned.Broadcast(NewContract);
-    OnArtistListChanged.Broadcast();
+    Commands.Run([this, NewContract = MoveTemp(NewContract)]()
+    {
+        ActiveContracts.Add(NewContract);
+        SimContracts.Add(MusicSimulation::MakeContractState(NewContract));
+        SimContractResults.AddDefaulted();
+        ScheduleContractExpiry(NewContract);
+        SubmitContractNews(ENewsCandidateKind::ArtistSigned, NewContract, NewContract.Terms.SignUpBonus,
+            NewContract.ArtistData.PerformanceScore);
+
+        OnArtistSigned.Broadcast(NewContract);
+        NotifyRosterChanged();
+    });
 }
 
 void UArtistManagerSubsystem::RejectArtist(const FString& ArtistId)
@@ -61,88 +116,214 @@ void UArtistManagerSubsystem::AdvanceMonth()
 {
     check(IsInGameThread());
 
-    TArray<FString> ContractsToExpire;
-    for (FArtistContract& Contract : ActiveContracts)
+    if (!ensureMsgf(!Commands.IsHeld(), TEXT("AdvanceMonth called while the month pipeline is stepping contracts.")))
     {
-        ProcessMonthlyContractFinancials(Contract);
-
-        const bool bReachedEndDate = CurrentGameDate >= Contract.EndDate;
-        const bool bReachedDuration = Contract.MonthsActive >= CalculateContractDurationMonths(Contract.Terms);
-        if (bReachedEndDate || bReachedDuration)
-        {
-            ContractsToExpire.Add(Contract.ArtistId);
-        }
+        return;
     }
 
-    for (const FString& ArtistId : ContractsToExpire)
+    int32 Cursor = 0;
+    StepMonth(CurrentMonth, Cursor, TNumericLimits<double>::Max());
+    ApplyContractResults();
+}
+
+void UArtistManagerSubsystem::HandleMonthBegun(const FGameMonth& PendingMonth)
+{
+    // The worker stage owns SimContracts from now until PublishMonth.
+    CurrentMonth = PendingMonth;
+    Commands.Hold();
+}
+
+bool UArtistManagerSubsystem::StepMonth(const FGameMonth& /*NewMonth*/, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    // Runs on a worker: touches only the simulated state, never ActiveContracts.
+    TRACE_CPUPROFILER_EVENT_SCOPE(UArtistManagerSubsystem::StepMonth);
+    SCOPE_CYCLE_COUNTER(STAT_ContractsStepMonth);
+
+    for (int32 ContractIndex = 0; ContractIndex < SimContracts.Num(); ++ContractIndex)
     {
-        ExpireContract(ArtistId);
+        SimContractResults[ContractIndex] = MusicSimulation::StepContractMonth(SimContracts[ContractIndex]);
     }
 
-    OnMonthlyFinancialUpdate.Broadcast(ActiveContracts);
+    Cursor = SimContracts.Num();
+    return true;
 }
 
-void UArtistManagerSubsystem::HandleMonthAdvanced(const FDateTime& NewDate)
+bool UArtistManagerSubsystem::PublishMonth(const FGameMonth& /*NewMonth*/, int32& Cursor, double /*DeadlineSeconds*/)
 {
     check(IsInGameThread());
 
-    CurrentGameDate = NewDate;
-    AdvanceMonth();
+    Cursor = ActiveContracts.Num();
+    ApplyContractResults();
+
+    // Expiries due this month were deferred behind the step, so they land after its financials.
+    Commands.Release();
+    return true;
 }
 
-void UArtistManagerSubsystem::ProcessMonthlyContractFinancials(FArtistContract& Contract)
+void UArtistManagerSubsystem::ApplyContractResults()
 {
-    Contract.MonthsActive++;
+    TRACE_CPUPROFILER_EVENT_SCOPE(UArtistManagerSubsystem::ApplyContractResults);
+    SCOPE_CYCLE_COUNTER(STAT_ContractsAdvanceMonth);
 
-    const float AudienceComposite = Contract.ArtistData.AudienceEngagement + Contract.ArtistData.StagePresence + Contract.ArtistData.PerformanceScore;
-    const float CreativeComposite = Contract.ArtistData.VocalQuality + Contract.ArtistData.SongwritingQuality;
-    const float PopularityFactor = FMath::Clamp((AudienceComposite + CreativeComposite) / 500.f, 0.1f, 2.5f);
+    check(SimContracts.Num() == ActiveContracts.Num());
+    for (int32 ContractIndex = 0; ContractIndex < ActiveContracts.Num(); ++ContractIndex)
+    {
+        FArtistContract& Contract = ActiveContracts[ContractIndex];
+        const FContractMonthResult& Result = SimContractResults[ContractIndex];
+        const float RevenueBefore = Contract.LifetimeRevenue;
 
-    Contract.PerformanceMomentum = FMath::Clamp(Contract.PerformanceMomentum * 0.85f + Contract.ArtistData.PerformanceScore * 0.15f, 0.f, 100.f);
+        MusicSimulation::ApplyContractMonth(Contract, SimContracts[ContractIndex], Result);
 
-    const float MomentumMultiplier = 1.f + (Contract.PerformanceMomentum / 200.f);
-    const float MonthlyGrossRevenue = (12000.f + Contract.MonthsActive * 400.f) * PopularityFactor * MomentumMultiplier;
+        if (Result.CompletedRecords > 0)
+        {
+            SubmitContractNews(ENewsCandidateKind::RecordDelivered, Contract, static_cast<float>(Result.CompletedRecords),
+                Contract.PerformanceMomentum);
+        }
 
-    const float RoyaltyPayment = MonthlyGrossRevenue * (Contract.Terms.RoyaltyRate / 100.f);
-    Contract.LastRoyaltyPayment = RoyaltyPayment;
-    Contract.CumulativeRoyaltyPaid += RoyaltyPayment;
+        const int32 Milestone = FindRevenueMilestoneCrossed(RevenueBefore, Contract.LifetimeRevenue);
+        if (Milestone != INDEX_NONE)
+        {
+            SubmitContractNews(ENewsCandidateKind::RevenueMilestone, Contract, RevenueMilestones[Milestone],
+                100.f * (Milestone + 1) / UE_ARRAY_COUNT(RevenueMilestones));
+        }
+    }
 
-    const float UpkeepCost = Contract.MonthlyUpkeepCost;
+    SET_DWORD_STAT(STAT_ActiveContracts, ActiveContracts.Num());
 
-    Contract.LifetimeRevenue += MonthlyGrossRevenue;
-    Contract.LifetimeCost += RoyaltyPayment + UpkeepCost;
+    OnMonthlyFinancialUpdate.Broadcast(ActiveContracts);
+}
 
-    const int32 ContractMonths = FMath::Max(CalculateContractDurationMonths(Contract.Terms), 1);
-    const float RecordsPerMonth = Contract.Terms.NumRecords > 0 ? static_cast<float>(Contract.Terms.NumRecords) / static_cast<float>(ContractMonths) : 0.f;
-    Contract.ProductionProgress += RecordsPerMonth;
+void UArtistManagerSubsystem::ProcessMonthlyContractFinancials(FArtistContract& Contract)
+{
+    FContractSimState State = MusicSimulation::MakeContractState(Contract);
+    const FContractMonthResult Month = MusicSimulation::StepContractMonth(State);
+    MusicSimulation::ApplyContractMonth(Contract, State, Month);
+}
 
-    if (Contract.ProductionProgress >= 1.f && Contract.Terms.NumRecords > Contract.RecordsDelivered)
+void UArtistManagerSubsystem::ForecastDeal(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo, FContractForecast& OutForecast) const
+{
+    FContractSimState State = MusicSimulation::MakeContractState(Deal, ArtistInfo);
+    const int32 ContractMonths = State.ContractMonths;
+
+    // Reset keeps the previous allocation, so repeated calls while dragging a slider don't hit the allocator.
+    OutForecast.ContractMonths = ContractMonths;
+    OutForecast.MonthlyRevenue.Reset(ContractMonths);
+    OutForecast.MonthlyCost.Reset(ContractMonths);
+    OutForecast.MonthlyRoyalty.Reset(ContractMonths);
+    OutForecast.CumulativeProfit.Reset(ContractMonths);
+    OutForecast.TotalRevenue = 0.f;
+    OutForecast.TotalCost = Deal.SignUpBonus;
+    OutForecast.TotalRoyalty = 0.f;
+    OutForecast.BreakEvenMonth = INDEX_NONE;
+
+    float RunningProfit = -Deal.SignUpBonus;
+    for (int32 MonthIndex = 0; MonthIndex < ContractMonths; ++MonthIndex)
     {
-        const int32 CompletedRecords = FMath::Clamp(static_cast<int32>(Contract.ProductionProgress), 0, Contract.Terms.NumRecords - Contract.RecordsDelivered);
-        Contract.RecordsDelivered += CompletedRecords;
-        Contract.ProductionProgress -= CompletedRecords;
+        const FContractMonthResult Month = MusicSimulation::StepContractMonth(State);
+        const float MonthCost = Month.RoyaltyPayment + Month.UpkeepCost;
+
+        RunningProfit += Month.GrossRevenue - MonthCost;
+
+        OutForecast.MonthlyRevenue.Add(Month.GrossRevenue);
+        OutForecast.MonthlyCost.Add(MonthCost);
+        OutForecast.MonthlyRoyalty.Add(Month.RoyaltyPayment);
+        OutForecast.CumulativeProfit.Add(RunningProfit);
+
+        OutForecast.TotalRevenue += Month.GrossRevenue;
+        OutForecast.TotalCost += MonthCost;
+        OutForecast.TotalRoyalty += Month.RoyaltyPayment;
+
+        if (OutForecast.BreakEvenMonth == INDEX_NONE && RunningProfit > 0.f)
+        {
+            OutForecast.BreakEvenMonth = MonthIndex;
+        }
     }
+
+    OutForecast.NetProfit = OutForecast.TotalRevenue - OutForecast.TotalCost;
+    OutForecast.ProjectedRecords = State.RecordsDelivered;
 }
 
-void UArtistManagerSubsystem::ExpireContract(const FString& ArtistId)
+int32 UArtistManagerSubsystem::AnalyzeDealRisk(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo, int32 Seed, const FOnDealRiskAnalyzed& OnComplete)
 {
-    const int32 ContractIndex = ActiveContracts.IndexOfByPredicate([&ArtistId](const FArtistContract& Contract)
+    check(IsInGameThread());
+
+    const int32 RequestId = LatestRiskRequestId->fetch_add(1) + 1;
+
+    FDealRiskSettings Settings;
+    Settings.NumSimulations = RiskSimulationCount;
+    Settings.Seed = Seed;
+    Settings.PerformanceVolatility = RiskPerformanceVolatility;
+    Settings.RevenuePerPopularityPoint = RiskRevenuePerPopularityPoint;
+
+    const TSharedRef<std::atomic<int32>, ESPMode::ThreadSafe> LatestRequest = LatestRiskRequestId;
+    const TWeakObjectPtr<UArtistManagerSubsystem> WeakThis(this);
+
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [Deal, ArtistInfo, Settings, RequestId, LatestRequest, WeakThis, OnComplete]()
     {
-        return Contract.ArtistId == ArtistId;
+        FDealRiskReport Report;
+        Report.RequestId = RequestId;
+
+        const bool bCompleted = FDealRiskSimulator::Run(Deal, ArtistInfo, Settings, Report, [&LatestRequest, RequestId]()
+        {
+            return LatestRequest->load(std::memory_order_relaxed) != RequestId;
+        });
+
+        if (!bCompleted)
+        {
+            return;
+        }
+
+        FGameThreadCommandQueue::Get().Enqueue([Report = MoveTemp(Report), LatestRequest, WeakThis, OnComplete]()
+        {
+            // A newer request may have been issued while this one was finishing.
+            if (!WeakThis.IsValid() || LatestRequest->load() != Report.RequestId)
+            {
+                return;
+            }
+
+            OnComplete.ExecuteIfBound(Report);
+        });
     });
 
-    if (ContractIndex != INDEX_NONE)
+    return RequestId;
+}
+
+void UArtistManagerSubsystem::ExpireContract(const FString& ArtistId)
+{
+    Commands.Run([this, ArtistId]()
     {
+        const int32 ContractIndex = ActiveContracts.IndexOfByPredicate([&ArtistId](const FArtistContract& Contract)
+        {
+            return Contract.ArtistId == ArtistId;
+        });
+
+        if (ContractIndex == INDEX_NONE)
+        {
+            return;
+        }
+
+        FCalendarEventHandle ExpiryEvent;
+        if (ContractExpiryEvents.RemoveAndCopyValue(ArtistId, ExpiryEvent))
+        {
+            if (UGameCalendarSubsystem* Calendar = GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>())
+            {
+                Calendar->CancelEvent(ExpiryEvent);
+            }
+        }
+
         FArtistContract Contract = ActiveContracts[ContractIndex];
         Contract.bContractActive = false;
-        Contract.EndDate = CurrentGameDate;
+        Contract.EndMonth = CurrentMonth;
 
         ActiveContracts.RemoveAt(ContractIndex);
+        SimContracts.RemoveAt(ContractIndex);
+        SimContractResults.RemoveAt(ContractIndex);
         ExpiredContracts.Add(Contract);
+        SubmitContractNews(ENewsCandidateKind::ContractExpired, Contract, 0.f, Contract.ArtistData.PerformanceScore);
 
         OnContractExpired.Broadcast(Contract);
-        OnArtistListChanged.Broadcast();
-    }
+        NotifyRosterChanged();
+    });
 }
 
 const FArtistContract* UArtistManagerSubsystem::GetContractByArtistId(const FString& ArtistId) const
@@ -153,14 +334,25 @@ const FArtistContract* UArtistManagerSubsystem::GetContractByArtistId(const FStr
     });
 }
 
-void UArtistManagerSubsystem::GetSignedArtistData(TArray<FArtistData>& OutArtistData) const
+FSignedRosterSnapshotRef UArtistManagerSubsystem::GetSignedRosterSnapshot() const
 {
-    OutArtistData.Reset();
+    ensure(IsInGameThread());
 
-    for (const FArtistContract& Contract : ActiveContracts)
+    if (!CachedRosterSnapshot.IsValid() || CachedRosterSnapshot->Version != RosterVersion)
     {
-        OutArtistData.Add(Contract.ArtistData);
+        TSharedRef<FSignedRosterSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FSignedRosterSnapshot, ESPMode::ThreadSafe>();
+        Snapshot->Version = RosterVersion;
+        Snapshot->Artists.Reserve(ActiveContracts.Num());
+
+        for (const FArtistContract& Contract : ActiveContracts)
+        {
+            Snapshot->Artists.Add(Contract.ArtistData);
+        }
+
+        CachedRosterSnapshot = Snapshot;
     }
+
+    return CachedRosterSnapshot.ToSharedRef();
 }
 
 const FArtistContract* UArtistManagerSubsystem::FindContractByArtistName(const FString& ArtistName) const
@@ -171,9 +363,49 @@ const FArtistContract* UArtistManagerSubsystem::FindContractByArtistName(const F
     });
 }
 
+void UArtistManagerSubsystem::NotifyRosterChanged()
+{
+    ++RosterVersion;
+    OnArtistListChanged.Broadcast();
+}
+
 int32 UArtistManagerSubsystem::CalculateContractDurationMonths(const FArtistDealTerms& Deal) const
 {
-    return FMath::Max(Deal.ContractYears * 12, 0);
+    return MusicSimulation::GetContractDurationMonths(Deal);
+}
+
+FGameMonth UArtistManagerSubsystem::GetContractExpiryMonth(const FArtistContract& Contract) const
+{
+    return MusicSimulation::GetContractExpiryMonth(Contract, CurrentMonth);
+}
+
+void UArtistManagerSubsystem::ScheduleContractExpiry(const FArtistContract& Contract)
+{
+    UGameCalendarSubsystem* Calendar = GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>();
+    if (!Calendar)
+    {
+        return;
+    }
+
+    FCalendarEventHandle& ExpiryEvent = ContractExpiryEvents.FindOrAdd(Contract.ArtistId);
+    Calendar->CancelEvent(ExpiryEvent);
+    ExpiryEvent = Calendar->ScheduleEvent(GetContractExpiryMonth(Contract), EMonthPhase::Contracts,
+        FCalendarEventDelegate::CreateUObject(this, &UArtistManagerSubsystem::HandleContractEnded, Contract.ArtistId));
+}
+
+void UArtistManagerSubsystem::HandleContractEnded(const FGameMonth& /*DueMonth*/, FString ArtistId)
+{
+    // The event has already fired, so there is nothing left to cancel.
+    ContractExpiryEvents.Remove(ArtistId);
+
+    // Deferred as a whole while the month's financials are in flight, so listeners see the contract's last month.
+    Commands.Run([this, ArtistId = MoveTemp(ArtistId)]()
+    {
+        ExpireContract(ArtistId);
+
+        SET_DWORD_STAT(STAT_ActiveContracts, ActiveContracts.Num());
+        OnMonthlyFinancialUpdate.Broadcast(ActiveContracts);
+    });
 }
 
 void UArtistManagerSubsystem::SaveState(UMusicSaveGame* SaveObject)
@@ -197,8 +429,53 @@ void UArtistManagerSubsystem::LoadState(const UMusicSaveGame* SaveObject)
         return;
     }
 
+    if (SaveObject->SavedMonth.IsValid())
+    {
+        CurrentMonth = SaveObject->SavedMonth;
+    }
+
+    if (UGameCalendarSubsystem* Calendar = GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>())
+    {
+        for (TPair<FString, FCalendarEventHandle>& ExpiryEvent : ContractExpiryEvents)
+        {
+            Calendar->CancelEvent(ExpiryEvent.Value);
+        }
+    }
+    ContractExpiryEvents.Reset();
+
+    // Callers settle the month in flight first, so no deferred signing or expiry targets the old roster.
+    ensure(!Commands.IsHeld());
+    Commands.Reset();
+
     ActiveContracts = SaveObject->SavedContracts;
     ExpiredContracts.Reset();
+
+    SimContracts.Reset(ActiveContracts.Num());
+    SimContractResults.SetNum(ActiveContracts.Num());
+    for (const FArtistContract& Contract : ActiveContracts)
+    {
+        SimContracts.Add(MusicSimulation::MakeContractState(Contract));
+        ScheduleContractExpiry(Contract);
+    }
     OnMonthlyFinancialUpdate.Broadcast(ActiveContracts);
-    OnArtistListChanged.Broadcast();
+    NotifyRosterChanged();
+}
+
+void UArtistManagerSubsystem::SubmitContractNews(ENewsCandidateKind Kind, const FArtistContract& Contract, float Amount, float Magnitude) const
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    UNewsGeneratorSubsystem* NewsGenerator = GameInstance ? GameInstance->GetSubsystem<UNewsGeneratorSubsystem>() : nullptr;
+    if (!NewsGenerator)
+    {
+        return;
+    }
+
+    FNewsCandidate Candidate;
+    Candidate.Kind = Kind;
+    Candidate.SubjectId = Contract.ArtistId;
+    Candidate.SubjectName = Contract.ArtistData.ArtistName;
+    Candidate.Genre = Contract.ArtistData.Genre;
+    Candidate.Amount = Amount;
+    Candidate.Magnitude = Magnitude;
+    NewsGenerator->AddCandidate(MoveTemp(Candidate));
 }
@@ -1,7 +1,7 @@
 #include "AuditionEventActor.h"
 
-#include "Async/Async.h"
 #include "EventSubsystem.h"
+#include "GameThreadCommandQueue.h"
 #include "Layout.h"
 
 AAuditionEventActor::AAuditionEventActor()
@@ -15,13 +15,9 @@ void AAuditionEventActor::StartAudition()
     // Always marshal to the game thread before touching UObjects that live on the UI tree.
     if (!IsInGameThread())
     {
-        const TWeakObjectPtr<AAuditionEventActor> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [](AAuditionEventActor& Self)
         {
-            if (AAuditionEventActor* StrongThis = WeakThis.Get())
-            {
-                StrongThis->StartAudition();
-            }
+            Self.StartAudition();
         });
         return;
     }
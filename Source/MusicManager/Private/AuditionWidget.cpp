@@ -158,6 +158,8 @@ void UAuditionWidget::RefreshDisplay()
     {
         SliderContractYears->SetValue(static_cast<float>(AuditionData.DealData.ContractYears));
     }
+
+    UpdateDealForecast();
 }
 
 void UAuditionWidget::HandleSignUpBonusChanged(float Value)
@@ -167,6 +169,7 @@ void UAuditionWidget::HandleSignUpBonusChanged(float Value)
     {
         TextSignUpBonusValue->SetText(FText::AsNumber(FMath::RoundToInt(Value)));
     }
+    UpdateDealForecast();
     OnNegotiationValueChanged();
 }
 
@@ -177,6 +180,7 @@ void UAuditionWidget::HandleNumOfRecordsChanged(float Value)
     {
         TextNumOfRecordsValue->SetText(FText::AsNumber(FMath::RoundToInt(Value)));
     }
+    UpdateDealForecast();
     OnNegotiationValueChanged();
 }
 
@@ -187,6 +191,7 @@ void UAuditionWidget::HandleRoyaltyRateChanged(float Value)
     {
         TextRoyaltyRateValue->SetText(FText::AsNumber(FMath::RoundToInt(Value)));
     }
+    UpdateDealForecast();
     OnNegotiationValueChanged();
 }
 
@@ -197,10 +202,11 @@ void UAuditionWidget::HandleContractYearsChanged(float Value)
     {
         TextContractYearsValue->SetText(FText::AsNumber(FMath::RoundToInt(Value)));
     }
+    UpdateDealForecast();
     OnNegotiationValueChanged();
 }
 
-void UAuditionWidget::HandleSignArtistClicked()
+FArtistDealTerms UAuditionWidget::BuildDealTerms() const
 {
     FArtistDealTerms Deal;
     Deal.ArtistId = AuditionData.ArtistData.ArtistName;
@@ -209,7 +215,41 @@ void UAuditionWidget::HandleSignArtistClicked()
     Deal.RoyaltyRate = SliderRoyaltyRate ? SliderRoyaltyRate->GetValue() : AuditionData.DealData.RoyaltyRate;
     Deal.SignUpBonus = SliderSignUpBonus ? SliderSignUpBonus->GetValue() : AuditionData.DealData.SignUpBonus;
     Deal.bExclusive = true;
-    Deal.ProposedStartDate = FDateTime::Now();
+    return Deal;
+}
+
+void UAuditionWidget::UpdateDealForecast()
+{
+    if (IsDesignTime())
+    {
+        return;
+    }
+
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (UArtistManagerSubsystem* Subsystem = GameInstance->GetSubsystem<UArtistManagerSubsystem>())
+        {
+            const FArtistDealTerms Deal = BuildDealTerms();
+            Subsystem->ForecastDeal(Deal, AuditionData.ArtistData, DealForecast);
+
+            // Seeding from the artist keeps the bands stable while only the terms change.
+            FOnDealRiskAnalyzed OnRiskAnalyzed;
+            OnRiskAnalyzed.BindDynamic(this, &UAuditionWidget::HandleDealRiskAnalyzed);
+            Subsystem->AnalyzeDealRisk(Deal, AuditionData.ArtistData, static_cast<int32>(GetTypeHash(AuditionData.ArtistData.ArtistName)), OnRiskAnalyzed);
+        }
+    }
+}
+
+void UAuditionWidget::HandleDealRiskAnalyzed(const FDealRiskReport& Report)
+{
+    DealRisk = Report;
+    OnDealRiskUpdated();
+}
+
+void UAuditionWidget::HandleSignArtistClicked()
+{
+    // Leave ProposedStartMonth unset so the contract starts in the current simulation month.
+    const FArtistDealTerms Deal = BuildDealTerms();
 
     if (UGameInstance* GameInstance = GetGameInstance())
     {
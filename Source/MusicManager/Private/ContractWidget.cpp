@@ -23,8 +23,8 @@ void UContractWidget::SetContractData(const FArtistContract& Contract)
     SetTextSafe(TextNumRecords, LexToString(ContractData.Terms.NumRecords));
     SetTextSafe(TextRoyaltyRate, FString::SanitizeFloat(ContractData.Terms.RoyaltyRate));
     SetTextSafe(TextSignUpBonus, FString::SanitizeFloat(ContractData.Terms.SignUpBonus));
-    SetTextSafe(TextStartDate, ContractData.StartDate.ToString());
-    SetTextSafe(TextEndDate, ContractData.EndDate.ToString());
+    SetTextSafe(TextStartDate, ContractData.StartMonth.ToDateTime().ToString(TEXT("%B %Y")));
+    SetTextSafe(TextEndDate, ContractData.EndMonth.ToDateTime().ToString(TEXT("%B %Y")));
     SetTextSafe(TextRecordsDelivered, LexToString(ContractData.RecordsDelivered));
     //SetTextSafe(TextContractActive, ContractData.bContractActive ? TEXT("True") : TEXT("False"));
     //SetTextSafe(TextLifetimeRevenue, FString::SanitizeFloat(ContractData.LifetimeRevenue));
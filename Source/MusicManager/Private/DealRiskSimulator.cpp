@@ -0,0 +1,129 @@
+#include "DealRiskSimulator.h"
+
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "SimulationModels.h"
+
+#include <atomic>
+
+namespace
+{
+    /** Simulations handed to a worker at a time; large enough to amortize scheduling, small enough to balance. */
+    constexpr int32 SimulationsPerBatch = 64;
+
+    /** Records kept charting per simulation; the oldest drops out once a prolific deal exceeds this. */
+    constexpr int32 MaxChartingRecords = 16;
+
+    float GetSortedPercentile(TArrayView<const float> Sorted, float Percentile)
+    {
+        const int32 Index = FMath::Clamp(FMath::RoundToInt(Percentile * (Sorted.Num() - 1)), 0, Sorted.Num() - 1);
+        return Sorted[Index];
+    }
+}
+
+bool FDealRiskSimulator::Run(const FArtistDealTerms& Deal, const FArtistData& Artist, const FDealRiskSettings& Settings,
+    FDealRiskReport& OutReport, TFunctionRef<bool()> ShouldCancel)
+{
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    const FContractSimState InitialState = MusicSimulation::MakeContractState(Deal, Artist);
+    const int32 ContractMonths = InitialState.ContractMonths;
+    const int32 NumSimulations = FMath::Max(Settings.NumSimulations, 1);
+    const float Volatility = FMath::Max(Settings.PerformanceVolatility, 0.f);
+
+    OutReport.NumSimulations = NumSimulations;
+    OutReport.CumulativeProfitP10.SetNumZeroed(ContractMonths);
+    OutReport.CumulativeProfitP50.SetNumZeroed(ContractMonths);
+    OutReport.CumulativeProfitP90.SetNumZeroed(ContractMonths);
+
+    if (ContractMonths <= 0)
+    {
+        OutReport.NetProfitP10 = OutReport.NetProfitP50 = OutReport.NetProfitP90 = -Deal.SignUpBonus;
+        OutReport.LossProbability = Deal.SignUpBonus > 0.f ? 1.f : 0.f;
+        OutReport.ElapsedMilliseconds = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+        return true;
+    }
+
+    // Month-major so every month's outcomes are contiguous for the percentile sort.
+    TArray<float> CumulativeProfit;
+    CumulativeProfit.SetNumUninitialized(ContractMonths * NumSimulations);
+
+    std::atomic<bool> bCancelled(false);
+
+    const int32 NumBatches = FMath::DivideAndRoundUp(NumSimulations, SimulationsPerBatch);
+    ParallelFor(NumBatches, [&](int32 BatchIndex)
+    {
+        if (bCancelled.load(std::memory_order_relaxed) || ShouldCancel())
+        {
+            bCancelled.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        TArray<FSongSimState, TInlineAllocator<MaxChartingRecords>> Records;
+
+        const int32 FirstSimulation = BatchIndex * SimulationsPerBatch;
+        const int32 LastSimulation = FMath::Min(FirstSimulation + SimulationsPerBatch, NumSimulations);
+        for (int32 SimulationIndex = FirstSimulation; SimulationIndex < LastSimulation; ++SimulationIndex)
+        {
+            // Seeding per simulation keeps results identical regardless of how batches land on workers.
+            FRandomStream Stream(static_cast<int32>(HashCombine(GetTypeHash(Settings.Seed), GetTypeHash(SimulationIndex))));
+
+            FContractSimState State = InitialState;
+            Records.Reset();
+
+            float RunningProfit = -Deal.SignUpBonus;
+            for (int32 MonthIndex = 0; MonthIndex < ContractMonths; ++MonthIndex)
+            {
+                const float PerformanceSample = FMath::Clamp(State.PerformanceScore * (1.f + Stream.FRandRange(-Volatility, Volatility)), 0.f, 100.f);
+                const FContractMonthResult Month = MusicSimulation::StepContractMonth(State, PerformanceSample);
+
+                for (int32 RecordIndex = 0; RecordIndex < Month.CompletedRecords; ++RecordIndex)
+                {
+                    if (Records.Num() == MaxChartingRecords)
+                    {
+                        Records.RemoveAt(0, 1, EAllowShrinking::No);
+                    }
+                    Records.Add(MusicSimulation::MakeRandomSongState(Stream));
+                }
+
+                float RecordRevenue = 0.f;
+                for (FSongSimState& Record : Records)
+                {
+                    MusicSimulation::StepSongMonth(Record, Stream.FRandRange(0.f, MusicSimulation::MaxViralRoll));
+                    RecordRevenue += Record.CurrentPopularity * Settings.RevenuePerPopularityPoint;
+                }
+
+                const float RecordRoyalty = RecordRevenue * (State.RoyaltyRate / 100.f);
+                RunningProfit += Month.GrossRevenue + RecordRevenue - Month.RoyaltyPayment - RecordRoyalty - Month.UpkeepCost;
+
+                CumulativeProfit[MonthIndex * NumSimulations + SimulationIndex] = RunningProfit;
+            }
+        }
+    });
+
+    if (bCancelled.load())
+    {
+        return false;
+    }
+
+    ParallelFor(ContractMonths, [&](int32 MonthIndex)
+    {
+        TArrayView<float> Outcomes(CumulativeProfit.GetData() + MonthIndex * NumSimulations, NumSimulations);
+        Algo::Sort(Outcomes);
+
+        OutReport.CumulativeProfitP10[MonthIndex] = GetSortedPercentile(Outcomes, 0.1f);
+        OutReport.CumulativeProfitP50[MonthIndex] = GetSortedPercentile(Outcomes, 0.5f);
+        OutReport.CumulativeProfitP90[MonthIndex] = GetSortedPercentile(Outcomes, 0.9f);
+    });
+
+    const TArrayView<const float> FinalOutcomes(CumulativeProfit.GetData() + (ContractMonths - 1) * NumSimulations, NumSimulations);
+    OutReport.NetProfitP10 = OutReport.CumulativeProfitP10.Last();
+    OutReport.NetProfitP50 = OutReport.CumulativeProfitP50.Last();
+    OutReport.NetProfitP90 = OutReport.CumulativeProfitP90.Last();
+    OutReport.LossProbability = static_cast<float>(Algo::LowerBound(FinalOutcomes, 0.f)) / static_cast<float>(NumSimulations);
+    OutReport.ElapsedMilliseconds = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+    return true;
+}
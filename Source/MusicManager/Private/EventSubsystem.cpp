@@ -2,25 +2,21 @@
 #include "EventSubsystem.h"
 
 #include "Blueprint/UserWidget.h"
-#include "EventTickerWidget.h"
+#include "GameThreadCommandQueue.h"
 #include "Layout.h"
+#include "MusicSaveGame.h"
+#include "NewsTextTemplates.h"
 #include "Engine/World.h"
-#include "Math/UnrealMathUtility.h"
-#include "TimerManager.h"
-#include "Async/Async.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 DEFINE_LOG_CATEGORY(LogEventSubsystem);
 
-namespace
-{
-    constexpr float MinTickInterval = 0.1f;
-    constexpr float MaxTickInterval = 60.0f;
-}
-
 void UEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    NewsStore.SetCapacity(NewsHistoryCapacity);
+
     if (!WorldInitHandle.IsValid())
     {
         WorldInitHandle = FWorldDelegates::OnPostWorldInitialization.AddUObject(this, &UEventSubsystem::HandlePostWorldInit);
@@ -37,14 +33,16 @@ void UEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     {
         if (CurrentWorld->IsGameWorld() && IsSameGameInstanceWorld(*CurrentWorld))
         {
-            StartTimerForWorld(CurrentWorld);
+            CachedWorld = CurrentWorld;
         }
     }
 }
 
 void UEventSubsystem::Deinitialize()
 {
-    StopTimer();
+    // A drain already handed to the command queue finds nothing left to post.
+    QueuedNews.Empty();
+    bDrainScheduled = false;
 
     if (WorldInitHandle.IsValid())
     {
@@ -61,6 +59,9 @@ void UEventSubsystem::Deinitialize()
     LayoutWeak.Reset();
     ChildWeak.Reset();
     CachedWorld.Reset();
+    NewsStore.Reset();
+    PendingHistory.Empty();
+    bHistoryPending = false;
 
     Super::Deinitialize();
 }
@@ -109,179 +110,206 @@ void UEventSubsystem::UnregisterLayout(ULayout* InLayout)
     ChildWeak.Reset();
 }
 
-void UEventSubsystem::HandlePostWorldInit(UWorld* InWorld, const UWorld::InitializationValues IVS)
+ULayout* UEventSubsystem::GetLayout() const
 {
-    (void)IVS;
-    if (!InWorld || !InWorld->IsGameWorld())
+    return LayoutWeak.Get();
+}
+
+FNewsHandle UEventSubsystem::PostNews(const FMusicNewsEvent& Event)
+{
+    if (!IsInGameThread())
     {
-        return;
+        QueueNews(FMusicNewsEvent(Event));
+        return FNewsHandle();
     }
 
-    if (!IsSameGameInstanceWorld(*InWorld))
+    // New items go after the saved ones, so those have to be in the store first.
+    EnsureHistoryLoaded();
+
+    const FNewsHandle Handle = NewsStore.Add(Event);
+
+    ULayout* Layout = LayoutWeak.Get();
+    if (!IsValid(Layout))
     {
-        return;
+        // Templated items have no Headline of their own, so the text is built from the stored record, and only
+        // when the message will actually be printed.
+        if (UE_LOG_ACTIVE(LogEventSubsystem, Verbose))
+        {
+            const FNewsRecord* Record = NewsStore.Find(Handle);
+            UE_LOG(LogEventSubsystem, Verbose, TEXT("PostNews: no layout registered; '%s' is only kept in the history."),
+                Record ? *FNewsTextTemplates::FormatHeadline(*Record, NewsStore).ToString() : *Event.Headline);
+        }
+        return Handle;
     }
 
-    if (CachedWorld.IsValid() && CachedWorld.Get() != InWorld)
+    Layout->AddNewsCardToFeed(Handle);
+    return Handle;
+}
+
+void UEventSubsystem::QueueNews(FMusicNewsEvent&& Event)
+{
+    QueuedNews.Enqueue(MoveTemp(Event));
+
+    // Only the producer that finds the subsystem idle wakes it; later ones ride along with the same drain.
+    if (!bDrainScheduled.exchange(true))
     {
-        StopTimer();
-        CachedWorld.Reset();
+        FGameThreadCommandQueue::Get().Enqueue(this, [](UEventSubsystem& Self)
+        {
+            Self.DrainQueuedNews();
+        });
     }
+}
 
-    UE_LOG(LogEventSubsystem, Verbose, TEXT("Post world initialization for %s."), *InWorld->GetName());
+void UEventSubsystem::DrainQueuedNews()
+{
+    check(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UEventSubsystem::DrainQueuedNews);
 
-    StartTimerForWorld(InWorld);
-    SendDummyNews();
+    // Cleared before draining so news queued while this runs schedules a drain of its own rather than being missed.
+    bDrainScheduled = false;
+
+    FMusicNewsEvent Event;
+    while (QueuedNews.Dequeue(Event))
+    {
+        PostNews(Event);
+    }
 }
 
-void UEventSubsystem::SendDummyNews()
+void UEventSubsystem::MarkNewsRolledUp(TConstArrayView<FNewsHandle> News)
 {
+    check(IsInGameThread());
 
-    if (LayoutWeak.IsValid())
+    for (const FNewsHandle Handle : News)
     {
-        FMusicNewsEvent Dummy;
-        Dummy.NewsId = FGuid::NewGuid();
-        Dummy.Timestamp = FDateTime::Now();
-        Dummy.NewsType = EMusicNewsType::NewUpcomingArtistPerforming;
-        Dummy.SourceName = TEXT("The Wild Beats");
-        Dummy.SubjectName = TEXT("New Artist");
-        Dummy.Headline = TEXT("New artist on the block!");
-        Dummy.BodyText = TEXT("Johnny Rocker performs at the Mug");
-        Dummy.Tags = { TEXT("Live"), TEXT("Rockabilly"), TEXT("Performance") };
+        NewsStore.MarkRolledUp(Handle);
+    }
+}
+
+bool UEventSubsystem::GetNewsEvent(FNewsHandle Handle, FMusicNewsEvent& OutEvent) const
+{
+    return NewsStore.MakeEvent(Handle, OutEvent);
+}
 
-        const TWeakObjectPtr<ULayout> LocalLayoutWeak = LayoutWeak;
-        AsyncTask(ENamedThreads::GameThread, [LocalLayoutWeak, Dummy]()
-            {
-                if (ULayout* LayoutPtr = LocalLayoutWeak.Get())
-                {
-                    if (IsValid(LayoutPtr))
-                    {
-                        LayoutPtr->AddNewsCardToFeed(Dummy);
-                    }
-                }
-            });
+int32 UEventSubsystem::QueryNews(const FNewsQuery& Query, TArray<FNewsHandle>& OutNews, int32 MaxResults)
+{
+    if (!ensure(IsInGameThread()))
+    {
+        OutNews.Reset();
+        return 0;
     }
+
+    EnsureHistoryLoaded();
+
+    return NewsStore.Query(Query, OutNews, MaxResults);
 }
 
-void UEventSubsystem::HandleWorldCleanup(UWorld* InWorld, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+void UEventSubsystem::SaveState(UMusicSaveGame* SaveObject)
 {
-    if (!InWorld || !InWorld->IsGameWorld())
+    check(IsInGameThread());
+
+    if (!SaveObject)
     {
         return;
     }
 
-    if (!IsSameGameInstanceWorld(*InWorld))
+    if (bHistoryPending)
     {
+        SaveObject->SavedNewsHistory = PendingHistory;
         return;
     }
 
-    if (CachedWorld.IsValid() && CachedWorld.Get() == InWorld)
+    NewsStore.SaveHistory(SaveObject->SavedNewsHistory);
+}
+
+void UEventSubsystem::LoadState(const UMusicSaveGame* SaveObject)
+{
+    check(IsInGameThread());
+
+    NewsStore.Reset();
+    PendingHistory.Reset();
+    bHistoryPending = false;
+
+    if (SaveObject && SaveObject->SavedNewsHistory.Num() > 0)
     {
-        UE_LOG(LogEventSubsystem, Verbose, TEXT("World cleanup for %s."), *InWorld->GetName());
-        StopTimer();
-        CachedWorld.Reset();
-        ChildWeak.Reset();
-        LayoutWeak.Reset();
+        PendingHistory = SaveObject->SavedNewsHistory;
+        bHistoryPending = true;
     }
 }
 
-void UEventSubsystem::StartTimerForWorld(UWorld* InWorld)
+void UEventSubsystem::EnsureHistoryLoaded()
 {
-    if (!InWorld || !InWorld->IsGameWorld())
+    if (!bHistoryPending || !ensure(IsInGameThread()))
     {
         return;
     }
 
-    if (!IsSameGameInstanceWorld(*InWorld))
+    TRACE_CPUPROFILER_EVENT_SCOPE(UEventSubsystem::EnsureHistoryLoaded);
+
+    bHistoryPending = false;
+    if (NewsStore.LoadHistory(PendingHistory))
+    {
+        UE_LOG(LogEventSubsystem, Verbose, TEXT("Loaded %d news items from %d saved bytes."), NewsStore.Num(), PendingHistory.Num());
+    }
+    PendingHistory.Empty();
+}
+
+void UEventSubsystem::HandlePostWorldInit(UWorld* InWorld, const UWorld::InitializationValues IVS)
+{
+    (void)IVS;
+    if (!InWorld || !InWorld->IsGameWorld())
     {
         return;
     }
 
-    const float ClampedInterval = FMath::Clamp(TickIntervalSeconds, MinTickInterval, MaxTickInterval);
-    if (!FMath::IsNearlyEqual(ClampedInterval, TickIntervalSeconds))
+    if (!IsSameGameInstanceWorld(*InWorld))
     {
-        TickIntervalSeconds = ClampedInterval;
+        return;
     }
 
-    FTimerManager& TimerManager = InWorld->GetTimerManager();
-    TimerManager.SetTimer(EventTimerHandle, this, &UEventSubsystem::OnTimerTick, ClampedInterval, true);
+    UE_LOG(LogEventSubsystem, Verbose, TEXT("Post world initialization for %s."), *InWorld->GetName());
 
     CachedWorld = InWorld;
-
-    UE_LOG(LogEventSubsystem, Display, TEXT("Started timer for world %s (interval %.2f seconds)."), *InWorld->GetName(), ClampedInterval);
+    SendDummyNews();
 }
 
-void UEventSubsystem::StopTimer()
+void UEventSubsystem::SendDummyNews()
 {
-    if (UWorld* World = CachedWorld.Get())
+
+    if (LayoutWeak.IsValid())
     {
-        if (World->IsGameWorld())
-        {
-            FTimerManager& TimerManager = World->GetTimerManager();
-            if (TimerManager.TimerExists(EventTimerHandle) || TimerManager.IsTimerActive(EventTimerHandle))
-            {
-                TimerManager.ClearTimer(EventTimerHandle);
-                UE_LOG(LogEventSubsystem, Display, TEXT("Stopped timer for world %s."), *World->GetName());
-            }
-            else
-            {
-                TimerManager.ClearTimer(EventTimerHandle);
-            }
-        }
-    }
+        FMusicNewsEvent Dummy;
+        Dummy.NewsId = FGuid::NewGuid();
+        Dummy.Timestamp = FDateTime::Now();
+        Dummy.NewsType = EMusicNewsType::NewUpcomingArtistPerforming;
+        Dummy.SourceName = TEXT("The Wild Beats");
+        Dummy.SubjectName = TEXT("New Artist");
+        Dummy.Headline = TEXT("New artist on the block!");
+        Dummy.BodyText = TEXT("Johnny Rocker performs at the Mug");
+        Dummy.Tags = { TEXT("Live"), TEXT("Rockabilly"), TEXT("Performance") };
 
-    EventTimerHandle.Invalidate();
+        PostNews(Dummy);
+    }
 }
 
-void UEventSubsystem::OnTimerTick()
+void UEventSubsystem::HandleWorldCleanup(UWorld* InWorld, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
 {
-    check(IsInGameThread());
-
-    UE_LOG(LogEventSubsystem, Verbose, TEXT("Event subsystem tick."));
-
-    UWorld* World = CachedWorld.Get();
-    if (!IsValid(World) || !World->IsGameWorld())
+    if (!InWorld || !InWorld->IsGameWorld())
     {
-        UE_LOG(LogEventSubsystem, Verbose, TEXT("Skipping tick due to invalid world."));
-        StopTimer();
-        CachedWorld.Reset();
-        ChildWeak.Reset();
         return;
     }
 
-    ULayout* Layout = LayoutWeak.Get();
-    if (!IsValid(Layout))
+    if (!IsSameGameInstanceWorld(*InWorld))
     {
-        UE_LOG(LogEventSubsystem, Verbose, TEXT("No layout registered; skipping tick."));
-        ChildWeak.Reset();
         return;
     }
 
-    if (Layout->GetWorld() != World)
+    if (CachedWorld.IsValid() && CachedWorld.Get() == InWorld)
     {
-        UE_LOG(LogEventSubsystem, Verbose, TEXT("Layout world mismatch; skipping tick."));
+        UE_LOG(LogEventSubsystem, Verbose, TEXT("World cleanup for %s."), *InWorld->GetName());
+        CachedWorld.Reset();
         ChildWeak.Reset();
-        return;
-    }
-
-    UUserWidget* Child = ChildWeak.Get();
-    if (!IsValid(Child))
-    {
-        Child = ResolveChildWidget(*Layout);
-        if (!IsValid(Child))
-        {
-            UE_LOG(LogEventSubsystem, Verbose, TEXT("Unable to resolve child widget for layout %s."), *Layout->GetName());
-            return;
-        }
-    }
-
-    if (UEventTickerWidget* Ticker = Cast<UEventTickerWidget>(Child))
-    {
-        /*Ticker->OnEventSubsystemTick();
-        return;*/
+        LayoutWeak.Reset();
     }
-
-    UE_LOG(LogEventSubsystem, Verbose, TEXT("Child widget %s is not an EventTickerWidget; skipping."), *Child->GetName());
 }
 
 UUserWidget* UEventSubsystem::ResolveChildWidget(ULayout& Layout)
@@ -1,7 +1,6 @@
 // File: Private/EventTickerWidget.cpp
 #include "EventTickerWidget.h"
 
-#include "Async/Async.h"
 #include "AuditionEventActor.h"
 #include "Components/Button.h"
 #include "Components/HorizontalBox.h"
@@ -9,8 +8,11 @@
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/Widget.h"
+#include "Engine/GameInstance.h"
 #include "EngineUtils.h"
+#include "GameThreadCommandQueue.h"
 #include "Layout.h"
+#include "NewsTextTemplates.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 UEventTickerWidget::UEventTickerWidget(const FObjectInitializer& ObjectInitializer)
@@ -31,23 +33,37 @@ void UEventTickerWidget::NativeConstruct()
     Refresh();
 }
 
-void UEventTickerWidget::SetNewsEvent(const FMusicNewsEvent& InEvent)
+void UEventTickerWidget::SetNewsEvent(FNewsHandle InNews)
 {
-    NewsEvent = InEvent;
-    CurrentNewsType = InEvent.NewsType;
+    NewsHandle = InNews;
+
+    const FNewsStore* Store = GetNewsStore();
+    const FNewsRecord* Record = Store ? Store->Find(NewsHandle) : nullptr;
+    CurrentNewsType = Record ? Record->NewsType : EMusicNewsType::None;
+
     Refresh();
 }
 
+bool UEventTickerWidget::GetNewsEvent(FMusicNewsEvent& OutEvent) const
+{
+    const FNewsStore* Store = GetNewsStore();
+    return Store && Store->MakeEvent(NewsHandle, OutEvent);
+}
+
+const FNewsStore* UEventTickerWidget::GetNewsStore() const
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    const UEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UEventSubsystem>() : nullptr;
+    return EventSubsystem ? &EventSubsystem->GetNewsStore() : nullptr;
+}
+
 void UEventTickerWidget::SetLayoutReference(ULayout* InLayout)
 {
     if (!IsInGameThread())
     {
-        AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UEventTickerWidget>(this), WeakLayout = TWeakObjectPtr<ULayout>(InLayout)]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [WeakLayout = TWeakObjectPtr<ULayout>(InLayout)](UEventTickerWidget& Self)
         {
-            if (UEventTickerWidget* Self = WeakThis.Get())
-            {
-                Self->SetLayoutReference(WeakLayout.Get());
-            }
+            Self.SetLayoutReference(WeakLayout.Get());
         });
         return;
     }
@@ -57,60 +73,83 @@ void UEventTickerWidget::SetLayoutReference(ULayout* InLayout)
 
 void UEventTickerWidget::Refresh_Implementation()
 {
+    const FNewsStore* Store = GetNewsStore();
+    const FNewsRecord* Record = Store ? Store->Find(NewsHandle) : nullptr;
+    if (!Record)
+    {
+        // Nothing bound yet, or the item is gone: show an empty card rather than stale text.
+        static const FNewsRecord EmptyRecord;
+        Record = &EmptyRecord;
+    }
+
+    const auto ToText = [Store](const FNewsText& Text)
+    {
+        return Text.Length == 0 ? FText::GetEmpty() : FText::FromString(FString(Store->GetText(Text)));
+    };
+
+    // Text is only built here, for cards that are in view; generated items are formatted from their template.
     if (IsValid(HeadlineText))
     {
-        HeadlineText->SetText(NewsEvent.Headline.IsEmpty() ? FText::GetEmpty() : FText::FromString(NewsEvent.Headline));
+        HeadlineText->SetText(Store ? FNewsTextTemplates::FormatHeadline(*Record, *Store) : FText::GetEmpty());
     }
 
     if (IsValid(SourceText))
     {
-        SourceText->SetText(NewsEvent.SourceName.IsEmpty() ? FText::GetEmpty() : FText::FromString(NewsEvent.SourceName));
+        SourceText->SetText(Record->Source.IsNone() ? FText::GetEmpty() : FText::FromName(Record->Source));
     }
 
     if (IsValid(TimestampText))
     {
-        const FString TimestampString = NewsEvent.Timestamp.ToString(TEXT("%b %d, %Y"));
-        TimestampText->SetText(FText::FromString(TimestampString));
+        TimestampText->SetText(FNewsTextTemplates::FormatCardDate(FDateTime(Record->TimestampTicks)));
     }
 
     if (IsValid(SubjectText))
     {
-        if (NewsEvent.SubjectName.IsEmpty())
+        if (Record->Subject.Length == 0)
         {
             SubjectText->SetText(FText::GetEmpty());
             SubjectText->SetVisibility(ESlateVisibility::Collapsed);
         }
         else
         {
-            SubjectText->SetText(FText::FromString(NewsEvent.SubjectName));
+            SubjectText->SetText(ToText(Record->Subject));
             SubjectText->SetVisibility(ESlateVisibility::Visible);
         }
     }
 
     if (IsValid(BodyText))
     {
-        BodyText->SetText(NewsEvent.BodyText.IsEmpty() ? FText::GetEmpty() : FText::FromString(NewsEvent.BodyText));
+        BodyText->SetText(Store ? FNewsTextTemplates::FormatBody(*Record, *Store) : FText::GetEmpty());
     }
 
     if (IsValid(TagContainer))
     {
-        TagContainer->ClearChildren();
-
-        for (const FString& Tag : NewsEvent.Tags)
+        // Tag labels are reused across re-binds; only a card showing more tags than ever before creates new ones.
+        int32 NumTagsShown = 0;
+        if (Store)
         {
-            if (Tag.IsEmpty())
+            Store->ForEachTag(Record->TagMask, [this, &NumTagsShown](FName Tag)
             {
-                continue;
-            }
+                UTextBlock* TagText = Cast<UTextBlock>(TagContainer->GetChildAt(NumTagsShown));
+                if (!TagText)
+                {
+                    TagText = NewObject<UTextBlock>(TagContainer);
+                    if (!IsValid(TagText))
+                    {
+                        return;
+                    }
+                    TagContainer->AddChildToHorizontalBox(TagText);
+                }
 
-            UTextBlock* TagText = NewObject<UTextBlock>(TagContainer);
-            if (!IsValid(TagText))
-            {
-                continue;
-            }
+                TagText->SetText(FText::FromName(Tag));
+                TagText->SetVisibility(ESlateVisibility::Visible);
+                ++NumTagsShown;
+            });
+        }
 
-            TagText->SetText(FText::FromString(Tag));
-            TagContainer->AddChildToHorizontalBox(TagText);
+        for (int32 ChildIndex = NumTagsShown; ChildIndex < TagContainer->GetChildrenCount(); ++ChildIndex)
+        {
+            TagContainer->GetChildAt(ChildIndex)->SetVisibility(ESlateVisibility::Collapsed);
         }
     }
 
@@ -119,7 +158,7 @@ void UEventTickerWidget::Refresh_Implementation()
         FLinearColor CategoryColor = FLinearColor::White;
         ESlateVisibility DesiredVisibility = ESlateVisibility::Visible;
 
-        switch (NewsEvent.NewsType)
+        switch (Record->NewsType)
         {
         case EMusicNewsType::None:
             DesiredVisibility = ESlateVisibility::Collapsed;
@@ -172,12 +211,9 @@ void UEventTickerWidget::OnClickButton()
 {
     if (!IsInGameThread())
     {
-        AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UEventTickerWidget>(this)]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [](UEventTickerWidget& Self)
         {
-            if (UEventTickerWidget* Self = WeakThis.Get())
-            {
-                Self->OnClickButton();
-            }
+            Self.OnClickButton();
         });
         return;
     }
@@ -191,36 +227,15 @@ void UEventTickerWidget::OnClickButton()
         break;
     }
 
-    if (IsValid(this))
-    {
-        AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UEventTickerWidget>(this)]()
-        {
-            if (UEventTickerWidget* Self = WeakThis.Get())
-            {
-                if (IsValid(Self))
-                {
-                    Self->OnNewsCardClicked.Broadcast(Self);
-                }
-            }
-        });
-    }
+    // Already on the game thread; listeners run now rather than a frame later.
+    OnNewsCardClicked.Broadcast(this);
 }
 
 void UEventTickerWidget::HandleUpcomingArtistAudition()
 {
-    if (LayoutRef.IsValid())
+    if (ULayout* Layout = LayoutRef.Get())
     {
-        const TWeakObjectPtr<ULayout> LocalLayout = LayoutRef;
-        AsyncTask(ENamedThreads::GameThread, [LocalLayout]()
-        {
-            if (ULayout* Layout = LocalLayout.Get())
-            {
-                if (IsValid(Layout))
-                {
-                    Layout->ShowAuditionWidget();
-                }
-            }
-        });
+        Layout->ShowAuditionWidget();
     }
 
     if (UWorld* World = GetWorld())
@@ -0,0 +1,315 @@
+#include "GameCalendarSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "GameTimeSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "MusicManagerStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Scheduled Calendar Events"), STAT_ScheduledCalendarEvents, STATGROUP_MusicSimulation);
+
+void UGameCalendarSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    BaseMonth = UGameTimeSubsystem::GetFirstMonth();
+
+    if (UGameTimeSubsystem* TimeSubsystem = Collection.InitializeDependency<UGameTimeSubsystem>())
+    {
+        BaseMonth = TimeSubsystem->GetCurrentMonth();
+
+        // Last in every phase and after its worker stages, so events see the state that phase's own stages
+        // produced for the month, and may touch it without racing a worker.
+        for (int32 PhaseIndex = 0; PhaseIndex < static_cast<int32>(EMonthPhase::Num); ++PhaseIndex)
+        {
+            const EMonthPhase Phase = static_cast<EMonthPhase>(PhaseIndex);
+            MonthStageHandles[PhaseIndex] = TimeSubsystem->RegisterMonthStage(Phase,
+                FName(*FString::Printf(TEXT("Calendar%s"), LexToString(Phase))),
+                FMonthStageDelegate::CreateUObject(this, &UGameCalendarSubsystem::FireDueEvents, Phase),
+                EMonthStageThread::GameThreadAfterWorkers, TNumericLimits<int32>::Max());
+        }
+    }
+}
+
+void UGameCalendarSubsystem::Deinitialize()
+{
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            for (FDelegateHandle& StageHandle : MonthStageHandles)
+            {
+                TimeSubsystem->UnregisterMonthStage(StageHandle);
+                StageHandle.Reset();
+            }
+        }
+    }
+
+    Events.Empty();
+    for (FEventList& List : Lists)
+    {
+        List = FEventList();
+    }
+    FirstFreeEvent = INDEX_NONE;
+    NumScheduledEvents = 0;
+    SET_DWORD_STAT(STAT_ScheduledCalendarEvents, 0);
+
+    Super::Deinitialize();
+}
+
+FCalendarEventHandle UGameCalendarSubsystem::ScheduleEvent(const FGameMonth& DueMonth, EMonthPhase Phase,
+    FCalendarEventDelegate Callback)
+{
+    check(IsInGameThread());
+
+    if (!ensure(DueMonth.IsValid() && Phase < EMonthPhase::Num))
+    {
+        return FCalendarEventHandle();
+    }
+
+    int32 EventIndex = FirstFreeEvent;
+    if (EventIndex != INDEX_NONE)
+    {
+        FirstFreeEvent = Events[EventIndex].Next;
+    }
+    else
+    {
+        EventIndex = Events.AddDefaulted();
+    }
+
+    FScheduledEvent& Event = Events[EventIndex];
+    Event.Callback = MoveTemp(Callback);
+    Event.Phase = Phase;
+
+    if (DueMonth < BaseMonth)
+    {
+        // Overdue: straight to the phase's due list, which the next run of that phase fires, keeping the month
+        // the caller asked for so the callback sees how late it is.
+        ensureMsgf(false, TEXT("Calendar event scheduled for %s, which is before the current month %s."),
+            *DueMonth.ToString(), *BaseMonth.ToString());
+        Event.DueMonth = DueMonth;
+        Link(EventIndex, FirstDueList + static_cast<int32>(Phase));
+    }
+    else
+    {
+        Event.DueMonth = DueMonth == BaseMonth ? BaseMonth + 1 : DueMonth;
+        Link(EventIndex, GetWheelList(Event.DueMonth));
+    }
+
+    ++NumScheduledEvents;
+    SET_DWORD_STAT(STAT_ScheduledCalendarEvents, NumScheduledEvents);
+
+    FCalendarEventHandle Handle;
+    Handle.Index = EventIndex;
+    Handle.Serial = Event.Serial;
+    return Handle;
+}
+
+bool UGameCalendarSubsystem::CancelEvent(FCalendarEventHandle& Handle)
+{
+    check(IsInGameThread());
+
+    const bool bWasScheduled = IsScheduled(Handle);
+    if (bWasScheduled)
+    {
+        Unlink(Handle.Index);
+        FreeEvent(Handle.Index);
+    }
+
+    Handle.Reset();
+    return bWasScheduled;
+}
+
+bool UGameCalendarSubsystem::IsScheduled(const FCalendarEventHandle& Handle) const
+{
+    return Events.IsValidIndex(Handle.Index)
+        && Events[Handle.Index].Serial == Handle.Serial
+        && Events[Handle.Index].List != INDEX_NONE;
+}
+
+void UGameCalendarSubsystem::ResetTo(const FGameMonth& Month)
+{
+    check(IsInGameThread());
+
+    for (int32 List = 0; List < NumLists; ++List)
+    {
+        while (Lists[List].Head != INDEX_NONE)
+        {
+            const int32 EventIndex = Lists[List].Head;
+            Unlink(EventIndex);
+            FreeEvent(EventIndex);
+        }
+    }
+
+    BaseMonth = Month.IsValid() ? Month : UGameTimeSubsystem::GetFirstMonth();
+}
+
+bool UGameCalendarSubsystem::FireDueEvents(const FGameMonth& Month, int32& Cursor, double DeadlineSeconds, EMonthPhase Phase)
+{
+    check(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UGameCalendarSubsystem::FireDueEvents);
+
+    // Whichever phase runs first this month turns the wheel.
+    if (BaseMonth != Month)
+    {
+        AdvanceTo(Month);
+    }
+
+    const FEventList& DueList = Lists[FirstDueList + static_cast<int32>(Phase)];
+    while (DueList.Head != INDEX_NONE)
+    {
+        const int32 EventIndex = DueList.Head;
+
+        // Freed before it runs, so the callback can reschedule or read IsScheduled without seeing itself.
+        FCalendarEventDelegate Callback = MoveTemp(Events[EventIndex].Callback);
+        const FGameMonth DueMonth = Events[EventIndex].DueMonth;
+        Unlink(EventIndex);
+        FreeEvent(EventIndex);
+
+        ++Cursor;
+        Callback.ExecuteIfBound(DueMonth);
+
+        if (FPlatformTime::Seconds() >= DeadlineSeconds)
+        {
+            return DueList.Head == INDEX_NONE;
+        }
+    }
+
+    return true;
+}
+
+void UGameCalendarSubsystem::AdvanceTo(const FGameMonth& Month)
+{
+    if (Month != BaseMonth + 1)
+    {
+        // Loaded or otherwise jumped: rebuild the wheel around the new month. Anything already overdue lands
+        // in the new month's slot and fires now.
+        BaseMonth = Month;
+        for (int32 List = 0; List < NumLists; ++List)
+        {
+            Cascade(List);
+        }
+    }
+    else
+    {
+        BaseMonth = Month;
+
+        // Crossing into a new block of a level pulls that block's events down, highest level first.
+        const int32 MonthIndex = Month.Index;
+        constexpr int32 SlotMask = SlotsPerLevel - 1;
+        for (int32 Level = NumLevels; Level > 0; --Level)
+        {
+            const int32 LevelShift = Level * SlotBits;
+            if ((MonthIndex & ((1 << LevelShift) - 1)) != 0)
+            {
+                continue;
+            }
+
+            Cascade(Level == NumLevels
+                ? OverflowList
+                : Level * SlotsPerLevel + ((MonthIndex >> LevelShift) & SlotMask));
+        }
+    }
+
+    const FEventList& Slot = Lists[Month.Index & (SlotsPerLevel - 1)];
+    while (Slot.Head != INDEX_NONE)
+    {
+        const int32 EventIndex = Slot.Head;
+        Unlink(EventIndex);
+        Link(EventIndex, FirstDueList + static_cast<int32>(Events[EventIndex].Phase));
+    }
+}
+
+void UGameCalendarSubsystem::Cascade(int32 List)
+{
+    int32 EventIndex = Lists[List].Head;
+    Lists[List] = FEventList();
+
+    while (EventIndex != INDEX_NONE)
+    {
+        const int32 NextIndex = Events[EventIndex].Next;
+        Link(EventIndex, GetWheelList(Events[EventIndex].DueMonth));
+        EventIndex = NextIndex;
+    }
+}
+
+int32 UGameCalendarSubsystem::GetWheelList(const FGameMonth& DueMonth) const
+{
+    // Overdue events go in the base month's slot.
+    const int32 Due = FMath::Max(DueMonth.Index, BaseMonth.Index);
+    const int32 Base = BaseMonth.Index;
+    constexpr int32 SlotMask = SlotsPerLevel - 1;
+
+    // Each level holds the events whose block at the level above matches the base month's.
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        const int32 BlockShift = (Level + 1) * SlotBits;
+        if ((Due >> BlockShift) == (Base >> BlockShift))
+        {
+            return Level * SlotsPerLevel + ((Due >> (Level * SlotBits)) & SlotMask);
+        }
+    }
+
+    return OverflowList;
+}
+
+void UGameCalendarSubsystem::Link(int32 EventIndex, int32 List)
+{
+    FScheduledEvent& Event = Events[EventIndex];
+    FEventList& EventList = Lists[List];
+
+    // Appending keeps events due together in the order they were scheduled.
+    Event.List = List;
+    Event.Prev = EventList.Tail;
+    Event.Next = INDEX_NONE;
+
+    if (EventList.Tail != INDEX_NONE)
+    {
+        Events[EventList.Tail].Next = EventIndex;
+    }
+    else
+    {
+        EventList.Head = EventIndex;
+    }
+    EventList.Tail = EventIndex;
+}
+
+void UGameCalendarSubsystem::Unlink(int32 EventIndex)
+{
+    FScheduledEvent& Event = Events[EventIndex];
+    FEventList& EventList = Lists[Event.List];
+
+    if (Event.Prev != INDEX_NONE)
+    {
+        Events[Event.Prev].Next = Event.Next;
+    }
+    else
+    {
+        EventList.Head = Event.Next;
+    }
+
+    if (Event.Next != INDEX_NONE)
+    {
+        Events[Event.Next].Prev = Event.Prev;
+    }
+    else
+    {
+        EventList.Tail = Event.Prev;
+    }
+
+    Event.List = INDEX_NONE;
+    Event.Prev = INDEX_NONE;
+    Event.Next = INDEX_NONE;
+}
+
+void UGameCalendarSubsystem::FreeEvent(int32 EventIndex)
+{
+    FScheduledEvent& Event = Events[EventIndex];
+    Event.Callback.Unbind();
+    ++Event.Serial;
+    Event.Next = FirstFreeEvent;
+    FirstFreeEvent = EventIndex;
+
+    --NumScheduledEvents;
+    SET_DWORD_STAT(STAT_ScheduledCalendarEvents, NumScheduledEvents);
+}
@@ -0,0 +1,82 @@
+#include "GameThreadCommandQueue.h"
+
+#include "MusicManagerStats.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_CYCLE_STAT(TEXT("GameThread Command Drain"), STAT_GameThreadCommandDrain, STATGROUP_MusicSimulation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GameThread Commands Run"), STAT_GameThreadCommandsRun, STATGROUP_MusicSimulation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GameThread Commands Coalesced"), STAT_GameThreadCommandsCoalesced, STATGROUP_MusicSimulation);
+
+FGameThreadCommandQueue& FGameThreadCommandQueue::Get()
+{
+    static FGameThreadCommandQueue Queue;
+    return Queue;
+}
+
+FGameThreadCommandQueue::FGameThreadCommandQueue()
+{
+    // The core ticker is thread-safe to register with, so the first user can be on any thread. The queue lives
+    // until shutdown, so the ticker is never removed.
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGameThreadCommandQueue::Tick));
+}
+
+void FGameThreadCommandQueue::EnqueueCommand(FCommand&& Command)
+{
+    // Counted first, so the count never drops below the commands actually in the queue.
+    NumQueued.fetch_add(1, std::memory_order_release);
+    Commands.Enqueue(MoveTemp(Command));
+}
+
+bool FGameThreadCommandQueue::TryClaimKey(const FCommandKey& Key)
+{
+    FScopeLock Lock(&PendingKeysLock);
+
+    bool bAlreadyPending = false;
+    PendingKeys.Add(Key, &bAlreadyPending);
+    if (bAlreadyPending)
+    {
+        INC_DWORD_STAT(STAT_GameThreadCommandsCoalesced);
+    }
+    return !bAlreadyPending;
+}
+
+bool FGameThreadCommandQueue::Tick(float /*DeltaTime*/)
+{
+    Drain();
+    return true;
+}
+
+void FGameThreadCommandQueue::Drain()
+{
+    check(IsInGameThread());
+
+    // Idle frames stop here.
+    int32 NumToRun = NumQueued.load(std::memory_order_acquire);
+    if (NumToRun == 0)
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(FGameThreadCommandQueue::Drain);
+    SCOPE_CYCLE_COUNTER(STAT_GameThreadCommandDrain);
+
+    // Only what was queued before the drain started runs now, so a command that queues another cannot keep the
+    // frame from ending.
+    FCommand Command;
+    while (NumToRun > 0 && Commands.Dequeue(Command))
+    {
+        --NumToRun;
+        NumQueued.fetch_sub(1, std::memory_order_relaxed);
+
+        // Released before running, so a refresh requested by the command itself is queued again for next frame.
+        if (Command.Key.IsSet())
+        {
+            FScopeLock Lock(&PendingKeysLock);
+            PendingKeys.Remove(Command.Key);
+        }
+
+        Command.Function();
+        INC_DWORD_STAT(STAT_GameThreadCommandsRun);
+    }
+}
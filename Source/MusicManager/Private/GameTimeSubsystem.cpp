@@ -1,10 +1,69 @@
 #include "GameTimeSubsystem.h"
 
+#include "Algo/BinarySearch.h"
 #include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "MusicManagerStats.h"
 #include "MusicSaveGame.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_CYCLE_STAT(TEXT("Month Pipeline"), STAT_MonthPipeline, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Month Phase: Songs"), STAT_MonthPhaseSongs, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Month Phase: Contracts"), STAT_MonthPhaseContracts, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Month Phase: Market"), STAT_MonthPhaseMarket, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Month Phase: News"), STAT_MonthPhaseNews, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Month Phase: UI"), STAT_MonthPhaseUI, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Frames per Month"), STAT_MonthFrames, STATGROUP_MusicSimulation);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Month Wall Time (ms)"), STAT_MonthWallTime, STATGROUP_MusicSimulation);
+
+namespace
+{
+    constexpr uint32 PhaseBit(EMonthPhase Phase)
+    {
+        return 1u << static_cast<uint32>(Phase);
+    }
+
+    constexpr int32 NumPhases = static_cast<int32>(EMonthPhase::Num);
+    constexpr uint32 AllPhases = (1u << NumPhases) - 1;
+
+    /** Phases each phase waits for. Songs, Contracts and Market share no data and run side by side. */
+    constexpr uint32 PhaseDependencies[] =
+    {
+        /* Songs */     0,
+        /* Contracts */ 0,
+        /* Market */    0,
+        /* News */      PhaseBit(EMonthPhase::Songs) | PhaseBit(EMonthPhase::Contracts) | PhaseBit(EMonthPhase::Market),
+        /* UI */        PhaseBit(EMonthPhase::News),
+    };
+    static_assert(UE_ARRAY_COUNT(PhaseDependencies) == NumPhases, "Every month phase needs a dependency entry.");
+
+    TStatId GetPhaseStatId(EMonthPhase Phase)
+    {
+        switch (Phase)
+        {
+        case EMonthPhase::Songs:
+            return GET_STATID(STAT_MonthPhaseSongs);
+        case EMonthPhase::Contracts:
+            return GET_STATID(STAT_MonthPhaseContracts);
+        case EMonthPhase::Market:
+            return GET_STATID(STAT_MonthPhaseMarket);
+        case EMonthPhase::News:
+            return GET_STATID(STAT_MonthPhaseNews);
+        default:
+            return GET_STATID(STAT_MonthPhaseUI);
+        }
+    }
+
+    /** Process working set; see FMonthProfiler for what it does and does not measure. */
+    int64 SampleWorkingSet()
+    {
+        return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+    }
+}
 
 UGameTimeSubsystem::UGameTimeSubsystem()
-    : CurrentGameDate(1955, 1, 1)
+    : CurrentMonth(GetFirstMonth())
     , bIsTimeRunning(false)
     , bHasReachedSimulationEnd(false)
 {
@@ -14,48 +73,385 @@ void UGameTimeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
-    CurrentGameDate = FDateTime(1955, 1, 1);
+    CurrentMonth = GetFirstMonth();
+    PendingMonth = FGameMonth();
     bHasReachedSimulationEnd = false;
     bIsTimeRunning = false;
 
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameTimeSubsystem::Tick));
+
     StartTimer();
 }
 
 void UGameTimeSubsystem::Deinitialize()
 {
     StopTimer();
+    WaitForWorkerStages();
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    MonthStages.Reset();
+    PendingMonth = FGameMonth();
+
     Super::Deinitialize();
 }
 
 void UGameTimeSubsystem::AdvanceMonth()
 {
     check(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UGameTimeSubsystem::AdvanceMonth);
 
-    if (HasSimulationEnded())
+    FlushPendingMonth();
+
+    if (BeginMonth())
+    {
+        RunMonthStages(TNumericLimits<double>::Max());
+    }
+}
+
+void UGameTimeSubsystem::FlushPendingMonth()
+{
+    check(IsInGameThread());
+
+    if (IsMonthInProgress())
+    {
+        bMonthQueued = false;
+        RunMonthStages(TNumericLimits<double>::Max());
+    }
+}
+
+FDelegateHandle UGameTimeSubsystem::RegisterMonthStage(EMonthPhase Phase, FName StageName, FMonthStageDelegate Work,
+    EMonthStageThread Thread, int32 OrderInPhase)
+{
+    check(IsInGameThread());
+    check(Phase < EMonthPhase::Num);
+
+    FMonthStage Stage;
+    Stage.Name = StageName;
+    Stage.TraceName = FString::Printf(TEXT("Month/%s/%s"), LexToString(Phase), *StageName.ToString());
+    Stage.Phase = Phase;
+    Stage.OrderInPhase = OrderInPhase;
+    Stage.Thread = Thread;
+    Stage.Work = MoveTemp(Work);
+
+    const FDelegateHandle StageHandle = Stage.Work.GetHandle();
+
+    // After every stage with the same phase and order, so registration order breaks ties.
+    const int32 InsertIndex = Algo::UpperBound(MonthStages, Stage, [](const FMonthStage& A, const FMonthStage& B)
+    {
+        return A.Phase != B.Phase ? A.Phase < B.Phase : A.OrderInPhase < B.OrderInPhase;
+    });
+    MonthStages.Insert(MoveTemp(Stage), InsertIndex);
+
+    return StageHandle;
+}
+
+void UGameTimeSubsystem::UnregisterMonthStage(FDelegateHandle StageHandle)
+{
+    check(IsInGameThread());
+
+    const int32 StageIndex = MonthStages.IndexOfByPredicate([StageHandle](const FMonthStage& Stage)
+    {
+        return Stage.Work.GetHandle() == StageHandle;
+    });
+
+    if (StageIndex == INDEX_NONE)
     {
-        StopTimer();
         return;
     }
 
-    int32 NewYear = CurrentGameDate.GetYear();
-    int32 NewMonth = CurrentGameDate.GetMonth() + 1;
+    if (MonthStages[StageIndex].Task.IsValid())
+    {
+        MonthStages[StageIndex].Task.Wait();
+    }
+
+    MonthStages.RemoveAt(StageIndex);
+}
 
-    if (NewMonth > 12)
+void UGameTimeSubsystem::WaitForWorkerStages()
+{
+    for (FMonthStage& Stage : MonthStages)
     {
-        NewMonth = 1;
-        ++NewYear;
+        if (Stage.Task.IsValid())
+        {
+            Stage.Task.Wait();
+        }
     }
+}
 
-    if (NewYear > 2026)
+bool UGameTimeSubsystem::BeginMonth()
+{
+    check(!IsMonthInProgress());
+
+    if (HasSimulationEnded())
+    {
+        StopTimer();
+        return false;
+    }
+
+    const FGameMonth NextMonth = CurrentMonth + 1;
+    if (NextMonth > GetLastMonth())
     {
         bHasReachedSimulationEnd = true;
         StopTimer();
+        return false;
+    }
+
+    PendingMonth = NextMonth;
+    StartedPhases = 0;
+
+    for (FMonthStage& Stage : MonthStages)
+    {
+        Stage.Cursor = 0;
+        Stage.bDone = false;
+        Stage.Task = UE::Tasks::TTask<FWorkerStageRun>();
+    }
+
+    ProfiledPhases = 0;
+    MonthProfiler.BeginMonth(PendingMonth);
+
+    OnMonthBegun.Broadcast(PendingMonth);
+
+    return true;
+}
+
+bool UGameTimeSubsystem::AreWorkerStagesDone(EMonthPhase Phase) const
+{
+    return !MonthStages.ContainsByPredicate([Phase](const FMonthStage& Stage)
+    {
+        return Stage.Phase == Phase && Stage.Thread == EMonthStageThread::Worker && !Stage.bDone;
+    });
+}
+
+bool UGameTimeSubsystem::IsPhaseComplete(EMonthPhase Phase) const
+{
+    if (!(StartedPhases & PhaseBit(Phase)))
+    {
+        return false;
+    }
+
+    for (const FMonthStage& Stage : MonthStages)
+    {
+        if (Stage.Phase == Phase && !Stage.bDone)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32 UGameTimeSubsystem::StartReadyPhases()
+{
+    for (FMonthStage& Stage : MonthStages)
+    {
+        if (!Stage.bDone && Stage.Task.IsValid() && Stage.Task.IsCompleted())
+        {
+            Stage.bDone = true;
+
+            const FWorkerStageRun& Run = Stage.Task.GetResult();
+            MonthProfiler.RecordSlice(Stage.Name, Stage.Phase, Run.Seconds, 0);
+            MonthProfiler.RecordStageDone(Stage.Name, Stage.Phase, Run.Entities);
+        }
+    }
+
+    // Dependencies only point at earlier phases, so one pass in phase order sees every completion it needs.
+    uint32 CompletedPhases = 0;
+    for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+    {
+        const EMonthPhase Phase = static_cast<EMonthPhase>(PhaseIndex);
+        if (!(StartedPhases & PhaseBit(Phase)))
+        {
+            if ((CompletedPhases & PhaseDependencies[PhaseIndex]) != PhaseDependencies[PhaseIndex])
+            {
+                continue;
+            }
+
+            StartedPhases |= PhaseBit(Phase);
+
+            for (FMonthStage& Stage : MonthStages)
+            {
+                if (Stage.Phase != Phase || Stage.Thread != EMonthStageThread::Worker || Stage.bDone)
+                {
+                    continue;
+                }
+
+                Stage.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+                    [Work = Stage.Work, Month = PendingMonth, TraceName = Stage.TraceName, StatId = GetPhaseStatId(Phase)]()
+                    {
+                        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*TraceName);
+                        FScopeCycleCounter PhaseCycles(StatId);
+
+                        FWorkerStageRun Run;
+                        const double StartSeconds = FPlatformTime::Seconds();
+
+                        int32 Cursor = 0;
+                        if (Work.IsBound())
+                        {
+                            const bool bFinished = Work.Execute(Month, Cursor, TNumericLimits<double>::Max());
+                            ensureMsgf(bFinished, TEXT("Worker month stages must finish in a single call."));
+                        }
+
+                        Run.Seconds = FPlatformTime::Seconds() - StartSeconds;
+                        Run.Entities = Cursor;
+                        return Run;
+                    });
+            }
+        }
+
+        if (IsPhaseComplete(Phase))
+        {
+            CompletedPhases |= PhaseBit(Phase);
+
+            if (!(ProfiledPhases & PhaseBit(Phase)))
+            {
+                ProfiledPhases |= PhaseBit(Phase);
+                MonthProfiler.RecordPhaseDone(Phase);
+            }
+        }
+    }
+
+    return CompletedPhases;
+}
+
+bool UGameTimeSubsystem::RunMonthStages(double DeadlineSeconds)
+{
+    check(IsMonthInProgress());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UGameTimeSubsystem::RunMonthStages);
+    SCOPE_CYCLE_COUNTER(STAT_MonthPipeline);
+
+    MonthProfiler.RecordFrame();
+
+    const bool bCanWait = DeadlineSeconds == TNumericLimits<double>::Max();
+
+    for (;;)
+    {
+        if (StartReadyPhases() == AllPhases)
+        {
+            CommitMonth();
+            return true;
+        }
+
+        // Game-thread stages go in phase order, then registration order, which keeps the month deterministic.
+        const int32 StageIndex = MonthStages.IndexOfByPredicate([this](const FMonthStage& Stage)
+        {
+            return !Stage.bDone && (StartedPhases & PhaseBit(Stage.Phase))
+                && (Stage.Thread == EMonthStageThread::GameThread
+                    || (Stage.Thread == EMonthStageThread::GameThreadAfterWorkers && AreWorkerStagesDone(Stage.Phase)));
+        });
+
+        if (StageIndex != INDEX_NONE)
+        {
+            // Copied so a stage may register or unregister stages while it runs.
+            const FMonthStageDelegate Work = MonthStages[StageIndex].Work;
+            const FName StageName = MonthStages[StageIndex].Name;
+            const EMonthPhase StagePhase = MonthStages[StageIndex].Phase;
+            int32 Cursor = MonthStages[StageIndex].Cursor;
+
+            const bool bTrackWorkingSet = FMonthProfiler::IsWorkingSetTrackingEnabled();
+            const int64 WorkingSetBefore = bTrackWorkingSet ? SampleWorkingSet() : 0;
+            const double SliceStartSeconds = FPlatformTime::Seconds();
+
+            bool bStageDone = true;
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*MonthStages[StageIndex].TraceName);
+                FScopeCycleCounter PhaseCycles(GetPhaseStatId(StagePhase));
+                bStageDone = !Work.IsBound() || Work.Execute(PendingMonth, Cursor, DeadlineSeconds);
+            }
+
+            MonthProfiler.RecordSlice(StageName, StagePhase, FPlatformTime::Seconds() - SliceStartSeconds,
+                bTrackWorkingSet ? SampleWorkingSet() - WorkingSetBefore : 0);
+            if (bStageDone)
+            {
+                MonthProfiler.RecordStageDone(StageName, StagePhase, Cursor);
+            }
+
+            const int32 UpdatedIndex = MonthStages.IndexOfByPredicate([&Work](const FMonthStage& Stage)
+            {
+                return Stage.Work.GetHandle() == Work.GetHandle();
+            });
+
+            if (UpdatedIndex != INDEX_NONE)
+            {
+                MonthStages[UpdatedIndex].Cursor = Cursor;
+                MonthStages[UpdatedIndex].bDone = bStageDone;
+            }
+
+            if (!bStageDone)
+            {
+                return false;
+            }
+        }
+        else if (bCanWait)
+        {
+            WaitForWorkerStages();
+        }
+        else
+        {
+            // Only worker stages are left running; check on them next frame.
+            return false;
+        }
+
+        if (FPlatformTime::Seconds() >= DeadlineSeconds)
+        {
+            return false;
+        }
+    }
+}
+
+void UGameTimeSubsystem::CommitMonth()
+{
+    CurrentMonth = PendingMonth;
+    PendingMonth = FGameMonth();
+
+    MonthProfiler.EndMonth();
+    if (const FMonthProfiler::FMonthSample* Sample = MonthProfiler.GetLastMonth())
+    {
+        SET_DWORD_STAT(STAT_MonthFrames, Sample->Frames);
+        SET_FLOAT_STAT(STAT_MonthWallTime, Sample->TotalMilliseconds);
+    }
+
+    OnMonthAdvanced.Broadcast(CurrentMonth);
+
+    if (bMonthQueued)
+    {
+        bMonthQueued = false;
+        BeginMonth();
+    }
+}
+
+void UGameTimeSubsystem::HandleTimerElapsed()
+{
+    check(IsInGameThread());
+
+    // A month that is still being sliced holds the next one back rather than piling up work.
+    if (IsMonthInProgress())
+    {
+        bMonthQueued = true;
         return;
     }
 
-    CurrentGameDate = FDateTime(NewYear, NewMonth, 1);
+    if (BeginMonth())
+    {
+        RunMonthStages(FPlatformTime::Seconds() + MonthSliceBudgetMilliseconds / 1000.0);
+    }
+}
 
-    OnMonthAdvanced.Broadcast(CurrentGameDate);
+bool UGameTimeSubsystem::Tick(float DeltaTime)
+{
+    check(IsInGameThread());
+
+    if (bIsTimeRunning && TimeSpeed == EGameTimeSpeed::Max)
+    {
+        TickMaxSpeed(DeltaTime);
+    }
+    else if (IsMonthInProgress())
+    {
+        RunMonthStages(FPlatformTime::Seconds() + MonthSliceBudgetMilliseconds / 1000.0);
+    }
+
+    return true;
 }
 
 void UGameTimeSubsystem::PauseTime(bool bPause)
@@ -75,6 +471,23 @@ void UGameTimeSubsystem::PauseTime(bool bPause)
     }
 }
 
+void UGameTimeSubsystem::SetTimeSpeed(EGameTimeSpeed NewSpeed)
+{
+    check(IsInGameThread());
+
+    if (TimeSpeed == NewSpeed)
+    {
+        return;
+    }
+
+    TimeSpeed = NewSpeed;
+
+    if (bIsTimeRunning)
+    {
+        StartTimer();
+    }
+}
+
 void UGameTimeSubsystem::StartTimer()
 {
     if (HasSimulationEnded())
@@ -82,9 +495,20 @@ void UGameTimeSubsystem::StartTimer()
         return;
     }
 
+    StopTimer();
+
+    if (TimeSpeed == EGameTimeSpeed::Max)
+    {
+        // Driven from Tick; no timer needed.
+        AverageMonthSeconds = 0.0;
+        MaxSpeedThrottleSeconds = 0.0;
+        bIsTimeRunning = true;
+        return;
+    }
+
     if (UWorld* World = GetWorld())
     {
-        World->GetTimerManager().SetTimer(TimeAdvanceHandle, this, &UGameTimeSubsystem::AdvanceMonth, 2.0f, true);
+        World->GetTimerManager().SetTimer(TimeAdvanceHandle, this, &UGameTimeSubsystem::HandleTimerElapsed, GetMonthIntervalSeconds(), true);
         bIsTimeRunning = true;
     }
 }
@@ -96,9 +520,62 @@ void UGameTimeSubsystem::StopTimer()
         World->GetTimerManager().ClearTimer(TimeAdvanceHandle);
     }
 
+    bMonthQueued = false;
     bIsTimeRunning = false;
 }
 
+void UGameTimeSubsystem::TickMaxSpeed(float DeltaTime)
+{
+    // Let the frames after an overrun through untouched until the overrun is paid back.
+    if (MaxSpeedThrottleSeconds > 0.0)
+    {
+        MaxSpeedThrottleSeconds -= DeltaTime;
+        return;
+    }
+
+    const double BudgetSeconds = MaxSpeedFrameBudgetMilliseconds / 1000.0;
+    const double FrameStartSeconds = FPlatformTime::Seconds();
+    const double DeadlineSeconds = FrameStartSeconds + BudgetSeconds;
+    double ElapsedSeconds = 0.0;
+
+    // Always make progress on one month, then keep going while the next one is expected to fit.
+    do
+    {
+        if (!IsMonthInProgress() && !BeginMonth())
+        {
+            break;
+        }
+
+        const double MonthStartSeconds = FPlatformTime::Seconds();
+        const bool bCommitted = RunMonthStages(DeadlineSeconds);
+        ElapsedSeconds = FPlatformTime::Seconds() - FrameStartSeconds;
+
+        if (!bCommitted)
+        {
+            break;
+        }
+
+        const double MonthSeconds = FPlatformTime::Seconds() - MonthStartSeconds;
+        AverageMonthSeconds = AverageMonthSeconds > 0.0 ? FMath::Lerp(AverageMonthSeconds, MonthSeconds, 0.2) : MonthSeconds;
+    }
+    while (bIsTimeRunning && TimeSpeed == EGameTimeSpeed::Max && ElapsedSeconds + AverageMonthSeconds <= BudgetSeconds);
+
+    MaxSpeedThrottleSeconds = FMath::Max(ElapsedSeconds - BudgetSeconds, 0.0);
+}
+
+float UGameTimeSubsystem::GetMonthIntervalSeconds() const
+{
+    switch (TimeSpeed)
+    {
+    case EGameTimeSpeed::Fast:
+        return NormalMonthSeconds / 2.f;
+    case EGameTimeSpeed::Faster:
+        return NormalMonthSeconds / 4.f;
+    default:
+        return NormalMonthSeconds;
+    }
+}
+
 bool UGameTimeSubsystem::HasSimulationEnded() const
 {
     if (bHasReachedSimulationEnd)
@@ -106,7 +583,7 @@ bool UGameTimeSubsystem::HasSimulationEnded() const
         return true;
     }
 
-    return CurrentGameDate.GetYear() > 2026;
+    return CurrentMonth > GetLastMonth();
 }
 
 void UGameTimeSubsystem::SaveState(UMusicSaveGame* SaveObject)
@@ -118,7 +595,7 @@ void UGameTimeSubsystem::SaveState(UMusicSaveGame* SaveObject)
 
     if (SaveObject)
     {
-        SaveObject->SavedGameDate = CurrentGameDate;
+        SaveObject->SavedMonth = CurrentMonth;
     }
 }
 
@@ -131,6 +608,11 @@ void UGameTimeSubsystem::LoadState(const UMusicSaveGame* SaveObject)
 
     if (SaveObject)
     {
-        CurrentGameDate = SaveObject->SavedGameDate;
+        // Whatever the interrupted month had done is overwritten by the loaded state.
+        WaitForWorkerStages();
+        PendingMonth = FGameMonth();
+        bMonthQueued = false;
+
+        CurrentMonth = SaveObject->SavedMonth.IsValid() ? SaveObject->SavedMonth : GetFirstMonth();
     }
 }
@@ -1,7 +1,8 @@
 // File: Private/Layout.cpp
 #include "Layout.h"
 
-#include "Async/Async.h"
+#include "GameThreadCommandQueue.h"
+#include "MusicManagerStats.h"
 #include "Blueprint/WidgetTree.h"
 #include "Components/Widget.h"
 #include "EventTickerWidget.h"
@@ -12,6 +13,13 @@
 #include "Engine/GameInstance.h"
 #include "UIManagerSubsystem.h"
 #include "UI/SignedArtistPanelWidget.h"
+#include "Templates/UnrealTemplate.h"
+#include "NewsTextTemplates.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("News Ticker Items Shown"), STAT_NewsTickerItemsShown, STATGROUP_MusicSimulation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("News Ticker Items Rolled Up"), STAT_NewsTickerItemsRolledUp, STATGROUP_MusicSimulation);
 
 ULayout::ULayout(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -34,15 +42,37 @@ void ULayout::NativeConstruct()
     {
         SignedArtistsPanel->OnArtistSelected.AddDynamic(this, &ULayout::HandleArtistSelected);
     }
+
+    if (IsValid(NewsFeedList))
+    {
+        // The feed may already have built cards for existing history while it was constructed.
+        NewsFeedList->OnCardAcquired.AddUniqueDynamic(this, &ULayout::BindTickerEvents);
+        for (UEventTickerWidget* Card : NewsFeedList->GetCards())
+        {
+            BindTickerEvents(Card);
+        }
+    }
 }
 
 void ULayout::NativeDestruct()
 {
+    if (NewsTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(NewsTickerHandle);
+        NewsTickerHandle.Reset();
+    }
+    NewsScheduler.Reset();
+
     if (IsValid(SignedArtistsPanel))
     {
         SignedArtistsPanel->OnArtistSelected.RemoveDynamic(this, &ULayout::HandleArtistSelected);
     }
 
+    if (IsValid(NewsFeedList))
+    {
+        NewsFeedList->OnCardAcquired.RemoveDynamic(this, &ULayout::BindTickerEvents);
+    }
+
     if (UUIManagerSubsystem* UIManager = GetUIManagerSubsystem())
     {
         if (IsValid(UIManager))
@@ -94,7 +124,7 @@ UUserWidget* ULayout::GetChildByNameOrClass(FName WidgetName, TSubclassOf<UUserW
     return nullptr;
 }
 
-void ULayout::AddNewsCardToFeed(const FMusicNewsEvent& Event)
+void ULayout::AddNewsCardToFeed(FNewsHandle News)
 {
     if (!ensure(IsInGameThread()))
     {
@@ -108,16 +138,143 @@ void ULayout::AddNewsCardToFeed(const FMusicNewsEvent& Event)
         return;
     }
 
-    if (UEventTickerWidget* NewTicker = NewsFeedList->AddNewsCard(Event))
+    // A roundup is handed to the feed by PostNewsRoundup itself.
+    if (bPostingNewsRoundup)
     {
-        BindTickerEvents(NewTicker);
+        return;
     }
-    else
+
+    UEventSubsystem* EventSubsystem = GetEventSubsystem();
+    const FNewsRecord* Record = EventSubsystem ? EventSubsystem->GetNewsStore().Find(News) : nullptr;
+    if (!Record)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddNewsCardToFeed: Failed to add news card."));
+        UE_LOG(LogTemp, Verbose, TEXT("AddNewsCardToFeed: news %u is not in the history."), News.Sequence);
+        return;
+    }
+
+    if (bNewsTickerBypassed)
+    {
+        const double FeedStart = FPlatformTime::Seconds();
+        NewsFeedList->AddNewsCard(News);
+        INC_DWORD_STAT(STAT_NewsTickerItemsShown);
+        ++NewsTickerTotals.NumCards;
+        ++NewsTickerTotals.NumItems;
+        NewsTickerTotals.FeedSeconds += FPlatformTime::Seconds() - FeedStart;
+        return;
+    }
+
+    NewsScheduler.CollapseThreshold = NewsRoundupThreshold;
+    NewsScheduler.Add(News, Record->NewsType);
+
+    // The first release waits one interval, so news posted together in the same frame is grouped before any
+    // of it is shown.
+    if (!NewsTickerHandle.IsValid())
+    {
+        NewsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ULayout::PumpNewsTicker),
+            1.f / FMath::Max(MaxNewsCardsPerSecond, 0.1f));
     }
 }
 
+bool ULayout::PumpNewsTicker(float /*DeltaTime*/)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ULayout::PumpNewsTicker);
+
+    FNewsTickerRelease Release;
+    UEventSubsystem* EventSubsystem = GetEventSubsystem();
+    if (IsValid(NewsFeedList) && IsValid(EventSubsystem) && NewsScheduler.Pop(Release))
+    {
+        const double FeedStart = FPlatformTime::Seconds();
+        if (Release.IsRoundup())
+        {
+            PostNewsRoundup(Release, *EventSubsystem);
+        }
+        else
+        {
+            // Cards are bound once, when the feed creates them; a null result only means the item is scrolled out of view.
+            NewsFeedList->AddNewsCard(Release.News[0]);
+            INC_DWORD_STAT(STAT_NewsTickerItemsShown);
+            ++NewsTickerTotals.NumCards;
+            ++NewsTickerTotals.NumItems;
+        }
+        NewsTickerTotals.FeedSeconds += FPlatformTime::Seconds() - FeedStart;
+    }
+
+    if (NewsScheduler.IsEmpty() || !IsValid(NewsFeedList))
+    {
+        NewsScheduler.Reset();
+        NewsTickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void ULayout::PostNewsRoundup(const FNewsTickerRelease& Release, UEventSubsystem& EventSubsystem)
+{
+    const FNewsStore& Store = EventSubsystem.GetNewsStore();
+
+    FMusicNewsEvent Roundup;
+    Roundup.NewsId = FGuid::NewGuid();
+    Roundup.NewsType = Release.NewsType;
+    Roundup.TextTemplate = ENewsTextTemplate::Roundup;
+    Roundup.Tags = { TEXT("Roundup") };
+
+    // The headline gives the count, so the body only names the first few.
+    constexpr int32 MaxNamedItems = 3;
+    TArray<FString, TInlineAllocator<MaxNamedItems>> Names;
+    FNewsHandle OnlyHeld;
+    int32 NumHeld = 0;
+    for (const FNewsHandle News : Release.News)
+    {
+        const FNewsRecord* Record = Store.Find(News);
+        if (!Record)
+        {
+            continue;
+        }
+
+        ++NumHeld;
+        OnlyHeld = News;
+        Roundup.Timestamp = FDateTime(Record->TimestampTicks);
+        if (Names.Num() < MaxNamedItems)
+        {
+            Names.Add(Record->Subject.Length > 0 ? FString(Store.GetText(Record->Subject)) : FNewsTextTemplates::FormatHeadline(*Record, Store).ToString());
+        }
+    }
+
+    // The history may have dropped some of the items while they waited.
+    if (NumHeld <= 1)
+    {
+        if (NumHeld == 1)
+        {
+            NewsFeedList->AddNewsCard(OnlyHeld);
+            INC_DWORD_STAT(STAT_NewsTickerItemsShown);
+            ++NewsTickerTotals.NumCards;
+            ++NewsTickerTotals.NumItems;
+        }
+        return;
+    }
+
+    Roundup.TextAmount = static_cast<float>(NumHeld);
+    Roundup.Metadata.Add(TEXT("Subjects"), FString::Join(Names, TEXT(", ")));
+
+    FNewsHandle RoundupHandle;
+    {
+        TGuardValue<bool> PostingGuard(bPostingNewsRoundup, true);
+        RoundupHandle = EventSubsystem.PostNews(Roundup);
+    }
+
+    // Marked in the history too, so a feed built later, e.g. after a load, also shows only the roundup.
+    if (RoundupHandle.IsValid())
+    {
+        EventSubsystem.MarkNewsRolledUp(Release.News);
+    }
+
+    NewsFeedList->AddNewsCard(RoundupHandle);
+    INC_DWORD_STAT(STAT_NewsTickerItemsShown);
+    INC_DWORD_STAT_BY(STAT_NewsTickerItemsRolledUp, NumHeld);
+    ++NewsTickerTotals.NumCards;
+    NewsTickerTotals.NumItems += NumHeld;
+}
+
 void ULayout::RemoveNewsCardFromFeed(UEventTickerWidget* Card)
 {
     if (!ensure(IsInGameThread()))
@@ -165,17 +322,11 @@ void ULayout::HandleTickerClicked(UEventTickerWidget* ClickedTicker)
 {
     if (!IsInGameThread())
     {
-        TWeakObjectPtr<ULayout> WeakThis(this);
-        TWeakObjectPtr<UEventTickerWidget> WeakTicker(ClickedTicker);
-
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakTicker]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [WeakTicker = TWeakObjectPtr<UEventTickerWidget>(ClickedTicker)](ULayout& Self)
         {
-            if (ULayout* Self = WeakThis.Get())
+            if (UEventTickerWidget* Ticker = WeakTicker.Get())
             {
-                if (UEventTickerWidget* Ticker = WeakTicker.Get())
-                {
-                    Self->HandleTickerClicked(Ticker);
-                }
+                Self.HandleTickerClicked(Ticker);
             }
         });
         return;
@@ -188,7 +339,7 @@ void ULayout::HandleTickerClicked(UEventTickerWidget* ClickedTicker)
 
     if (UUIManagerSubsystem* UI = GetUIManagerSubsystem())
     {
-        UI->HandleNewsCardSelected(ClickedTicker->NewsEvent);
+        UI->HandleNewsCardSelected(ClickedTicker->GetNewsHandle());
     }
 }
 
@@ -196,13 +347,9 @@ void ULayout::ShowAuditionWidgetWithData(const FAuditionEvent& EventData)
 {
     if (!IsInGameThread())
     {
-        TWeakObjectPtr<ULayout> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, EventData]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [EventData](ULayout& Self)
         {
-            if (ULayout* Self = WeakThis.Get())
-            {
-                Self->ShowAuditionWidgetWithData(EventData);
-            }
+            Self.ShowAuditionWidgetWithData(EventData);
         });
         return;
     }
@@ -224,13 +371,9 @@ void ULayout::ShowAuditionWidget()
 {
     if (!IsInGameThread())
     {
-        TWeakObjectPtr<ULayout> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [](ULayout& Self)
         {
-            if (ULayout* Self = WeakThis.Get())
-            {
-                Self->ShowAuditionWidget();
-            }
+            Self.ShowAuditionWidget();
         });
         return;
     }
@@ -259,17 +402,23 @@ void ULayout::RefreshSignedArtists(const TArray<FArtistData>& Artists)
     SignedArtistsPanel->PopulateArtistList(Artists);
 }
 
+void ULayout::RefreshSignedArtistRoster(const FSignedRosterSnapshotRef& Roster)
+{
+    if (!IsValid(SignedArtistsPanel))
+    {
+        return;
+    }
+
+    SignedArtistsPanel->PopulateArtistList(Roster);
+}
+
 void ULayout::ShowContract(const FArtistContract& SignedContract)
 {
     if (!IsInGameThread())
     {
-        TWeakObjectPtr<ULayout> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, SignedContract]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [SignedContract](ULayout& Self)
         {
-            if (ULayout* Self = WeakThis.Get())
-            {
-                Self->ShowContract(SignedContract);
-            }
+            Self.ShowContract(SignedContract);
         });
         return;
     }
@@ -298,13 +447,9 @@ void ULayout::HandleArtistSelected(FString ArtistId)
 {
     if (!IsInGameThread())
     {
-        TWeakObjectPtr<ULayout> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, ArtistId]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [ArtistId = MoveTemp(ArtistId)](ULayout& Self)
         {
-            if (ULayout* Self = WeakThis.Get())
-            {
-                Self->HandleArtistSelected(ArtistId);
-            }
+            Self.HandleArtistSelected(ArtistId);
         });
         return;
     }
@@ -325,3 +470,14 @@ UUIManagerSubsystem* ULayout::GetUIManagerSubsystem() const
 
     return GI->GetSubsystem<UUIManagerSubsystem>();
 }
+
+UEventSubsystem* ULayout::GetEventSubsystem() const
+{
+    UGameInstance* GI = GetGameInstance();
+    if (!GI)
+    {
+        return nullptr;
+    }
+
+    return GI->GetSubsystem<UEventSubsystem>();
+}
@@ -0,0 +1,172 @@
+#include "MonthProfiler.h"
+
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarMonthProfiler(
+        TEXT("mm.MonthProfiler"),
+        0,
+        TEXT("Month tick profiling.\n")
+        TEXT(" 0: stage timings and entity counts only\n")
+        TEXT(" 1: also sample working-set (used physical memory) deltas per stage slice; process-wide, not an allocation count\n")
+        TEXT(" 2: also show a rolling per-stage summary on screen"),
+        ECVF_Default);
+
+    /** Fixed key so each summary replaces the previous one on screen. */
+    constexpr uint64 OnScreenSummaryKey = 0x4D4D50524F46ull;
+}
+
+bool FMonthProfiler::IsWorkingSetTrackingEnabled()
+{
+    return CVarMonthProfiler.GetValueOnGameThread() >= 1;
+}
+
+bool FMonthProfiler::IsOnScreenSummaryEnabled()
+{
+    return CVarMonthProfiler.GetValueOnGameThread() >= 2;
+}
+
+void FMonthProfiler::BeginMonth(const FGameMonth& Month)
+{
+    // Reuses the stage array so steady-state months do not allocate.
+    TArray<FStageSample> Stages = MoveTemp(Current.Stages);
+    Stages.Reset();
+
+    Current = FMonthSample();
+    Current.Month = Month;
+    Current.Stages = MoveTemp(Stages);
+
+    MonthStartSeconds = FPlatformTime::Seconds();
+}
+
+void FMonthProfiler::RecordFrame()
+{
+    ++Current.Frames;
+}
+
+void FMonthProfiler::RecordSlice(FName StageName, EMonthPhase Phase, double Seconds, int64 WorkingSetDeltaBytes)
+{
+    FStageSample& Stage = FindOrAddStage(StageName, Phase);
+    Stage.Milliseconds += Seconds * 1000.0;
+    Stage.WorkingSetDeltaBytes += WorkingSetDeltaBytes;
+    ++Stage.Slices;
+}
+
+void FMonthProfiler::RecordStageDone(FName StageName, EMonthPhase Phase, int32 Entities)
+{
+    FindOrAddStage(StageName, Phase).Entities = Entities;
+}
+
+void FMonthProfiler::RecordPhaseDone(EMonthPhase Phase)
+{
+    Current.PhaseMilliseconds[static_cast<int32>(Phase)] = (FPlatformTime::Seconds() - MonthStartSeconds) * 1000.0;
+}
+
+void FMonthProfiler::EndMonth()
+{
+    Current.TotalMilliseconds = (FPlatformTime::Seconds() - MonthStartSeconds) * 1000.0;
+
+    // Swapped rather than copied: the slot's old stage array comes back as Current's and is reused by the next
+    // BeginMonth, so nothing is allocated here.
+    Swap(History[NextHistoryIndex], Current);
+    NextHistoryIndex = (NextHistoryIndex + 1) % HistorySize;
+    NumRecorded = FMath::Min(NumRecorded + 1, HistorySize);
+
+    if (GEngine && IsOnScreenSummaryEnabled())
+    {
+        GEngine->AddOnScreenDebugMessage(OnScreenSummaryKey, 5.f, FColor::Cyan, BuildSummary());
+    }
+}
+
+const FMonthProfiler::FMonthSample* FMonthProfiler::GetLastMonth() const
+{
+    if (NumRecorded == 0)
+    {
+        return nullptr;
+    }
+
+    return &History[(NextHistoryIndex + HistorySize - 1) % HistorySize];
+}
+
+FString FMonthProfiler::BuildSummary() const
+{
+    const FMonthSample* LastMonth = GetLastMonth();
+    if (!LastMonth)
+    {
+        return FString();
+    }
+
+    struct FStageTotals
+    {
+        double Milliseconds = 0.0;
+        double PeakMilliseconds = 0.0;
+        int64 Entities = 0;
+        int64 WorkingSetDeltaBytes = 0;
+        int32 Months = 0;
+    };
+
+    TMap<FName, FStageTotals> Totals;
+    double TotalMilliseconds = 0.0;
+    int32 TotalFrames = 0;
+
+    for (int32 HistoryIndex = 0; HistoryIndex < NumRecorded; ++HistoryIndex)
+    {
+        const FMonthSample& Month = History[HistoryIndex];
+        TotalMilliseconds += Month.TotalMilliseconds;
+        TotalFrames += Month.Frames;
+
+        for (const FStageSample& Stage : Month.Stages)
+        {
+            FStageTotals& StageTotals = Totals.FindOrAdd(Stage.StageName);
+            StageTotals.Milliseconds += Stage.Milliseconds;
+            StageTotals.PeakMilliseconds = FMath::Max(StageTotals.PeakMilliseconds, Stage.Milliseconds);
+            StageTotals.Entities += Stage.Entities;
+            StageTotals.WorkingSetDeltaBytes += Stage.WorkingSetDeltaBytes;
+            ++StageTotals.Months;
+        }
+    }
+
+    const int32 NumMonths = NumRecorded;
+
+    FString Summary = FString::Printf(TEXT("Month %s: %.2f ms over %d frames (avg of last %d: %.2f ms, %.1f frames)\n"),
+        *LastMonth->Month.ToString(), LastMonth->TotalMilliseconds, LastMonth->Frames, NumMonths,
+        TotalMilliseconds / NumMonths, static_cast<double>(TotalFrames) / NumMonths);
+
+    // Stages listed in the order the last month ran them.
+    for (const FStageSample& Stage : LastMonth->Stages)
+    {
+        const FStageTotals& StageTotals = Totals.FindChecked(Stage.StageName);
+        Summary += FString::Printf(TEXT("  [%s] %s: avg %.3f ms, peak %.3f ms, %lld entities"),
+            LexToString(Stage.Phase), *Stage.StageName.ToString(),
+            StageTotals.Milliseconds / StageTotals.Months, StageTotals.PeakMilliseconds,
+            StageTotals.Entities / StageTotals.Months);
+
+        if (IsWorkingSetTrackingEnabled())
+        {
+            Summary += FString::Printf(TEXT(", avg working set %+lld KB"), StageTotals.WorkingSetDeltaBytes / StageTotals.Months / 1024);
+        }
+
+        Summary += TEXT("\n");
+    }
+
+    return Summary;
+}
+
+FMonthProfiler::FStageSample& FMonthProfiler::FindOrAddStage(FName StageName, EMonthPhase Phase)
+{
+    for (FStageSample& Stage : Current.Stages)
+    {
+        if (Stage.StageName == StageName)
+        {
+            return Stage;
+        }
+    }
+
+    FStageSample& Stage = Current.Stages.AddDefaulted_GetRef();
+    Stage.StageName = StageName;
+    Stage.Phase = Phase;
+    return Stage;
+}
@@ -1,3 +1,45 @@
 #include "MusicSaveGame.h"
 
-// Intentionally empty: UMusicSaveGame currently relies on generated serialization only.
+#include "SimulationModels.h"
+
+void UMusicSaveGame::UpgradeToLatest()
+{
+    if (SaveVersion < static_cast<int32>(EMusicSaveVersion::GameMonths))
+    {
+        // A default FDateTime has zero ticks and stands for a date that was never set.
+        const auto ToGameMonth = [](const FDateTime& Date)
+        {
+            return Date.GetTicks() > 0 ? FGameMonth::FromDateTime(Date) : FGameMonth();
+        };
+
+        SavedMonth = ToGameMonth(SavedGameDate_DEPRECATED);
+
+        for (FArtistContract& Contract : SavedContracts)
+        {
+            Contract.StartMonth = ToGameMonth(Contract.StartDate_DEPRECATED);
+
+            // The old end date was a 30-day approximation; the length of the deal is what it meant.
+            Contract.EndMonth = Contract.StartMonth.IsValid()
+                ? Contract.StartMonth + MusicSimulation::GetContractDurationMonths(Contract.Terms)
+                : FGameMonth();
+        }
+
+        // ReleaseMonth was loaded from the old calendar month, 1-12, which only means something with the year.
+        for (FSavedSong& SavedSong : SavedSongs)
+        {
+            FSongData& Data = SavedSong.Data;
+            const int32 CalendarMonth = Data.ReleaseMonth.Index;
+            Data.ReleaseMonth = Data.ReleaseYear_DEPRECATED > 0 && CalendarMonth >= 1 && CalendarMonth <= 12
+                ? FGameMonth::FromYearMonth(Data.ReleaseYear_DEPRECATED, CalendarMonth)
+                : FGameMonth();
+        }
+    }
+
+    if (SaveVersion < static_cast<int32>(EMusicSaveVersion::CampaignSeed))
+    {
+        // Viral rolls were unseeded back then, so any seed continues the campaign as faithfully as another.
+        CampaignSeed = MusicSimulation::MakeCampaignSeed();
+    }
+
+    SaveVersion = static_cast<int32>(EMusicSaveVersion::Latest);
+}
@@ -1,7 +1,9 @@
 #include "MusicSaveSubsystem.h"
 
 #include "ArtistManagerSubsystem.h"
-#include "Async/Async.h"
+#include "EventSubsystem.h"
+#include "GameCalendarSubsystem.h"
+#include "GameThreadCommandQueue.h"
 #include "GameTimeSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "MusicSaveGame.h"
@@ -14,14 +16,9 @@ void UMusicSaveSubsystem::SaveGame(const FString& SlotName)
 {
     if (!IsInGameThread())
     {
-        const FString SafeSlot = SlotName;
-        TWeakObjectPtr<UMusicSaveSubsystem> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, SafeSlot]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [SlotName](UMusicSaveSubsystem& Self)
         {
-            if (UMusicSaveSubsystem* StrongThis = WeakThis.Get())
-            {
-                StrongThis->SaveGame(SafeSlot);
-            }
+            Self.SaveGame(SlotName);
         });
         return;
     }
@@ -38,9 +35,16 @@ void UMusicSaveSubsystem::SaveGame(const FString& SlotName)
         UE_LOG(LogMusicSaveSubsystem, Error, TEXT("Failed to allocate save game object."));
         return;
     }
+    SaveObject->SaveVersion = static_cast<int32>(EMusicSaveVersion::Latest);
 
     if (UGameInstance* GameInstance = GetGameInstance())
     {
+        // Never save a month that is only partly simulated.
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            TimeSubsystem->FlushPendingMonth();
+        }
+
         if (USongManagerSubsystem* SongManager = GameInstance->GetSubsystem<USongManagerSubsystem>())
         {
             SongManager->SaveState(SaveObject);
@@ -55,6 +59,11 @@ void UMusicSaveSubsystem::SaveGame(const FString& SlotName)
         {
             TimeSubsystem->SaveState(SaveObject);
         }
+
+        if (UEventSubsystem* EventSubsystem = GameInstance->GetSubsystem<UEventSubsystem>())
+        {
+            EventSubsystem->SaveState(SaveObject);
+        }
     }
 
     if (WriteToSlot(SaveObject, SlotName))
@@ -67,14 +76,9 @@ void UMusicSaveSubsystem::LoadGame(const FString& SlotName)
 {
     if (!IsInGameThread())
     {
-        const FString SafeSlot = SlotName;
-        TWeakObjectPtr<UMusicSaveSubsystem> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, SafeSlot]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [SlotName](UMusicSaveSubsystem& Self)
         {
-            if (UMusicSaveSubsystem* StrongThis = WeakThis.Get())
-            {
-                StrongThis->LoadGame(SafeSlot);
-            }
+            Self.LoadGame(SlotName);
         });
         return;
     }
@@ -92,8 +96,38 @@ void UMusicSaveSubsystem::LoadGame(const FString& SlotName)
         return;
     }
 
+    if (SaveObject->SaveVersion > static_cast<int32>(EMusicSaveVersion::Latest))
+    {
+        UE_LOG(LogMusicSaveSubsystem, Warning, TEXT("Slot '%s' was written by a newer version (%d); refusing to load it."),
+            *SlotName, SaveObject->SaveVersion);
+        return;
+    }
+    if (SaveObject->SaveVersion < static_cast<int32>(EMusicSaveVersion::Latest))
+    {
+        UE_LOG(LogMusicSaveSubsystem, Log, TEXT("Upgrading slot '%s' from save version %d."), *SlotName, SaveObject->SaveVersion);
+        SaveObject->UpgradeToLatest();
+    }
+
     if (UGameInstance* GameInstance = GetGameInstance())
     {
+        // Settle the month in flight first, so no worker stage is still stepping the state being replaced.
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            TimeSubsystem->FlushPendingMonth();
+        }
+
+        // Time comes first and the calendar is moved to the loaded month before the managers reschedule their
+        // releases and expiries against it.
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            TimeSubsystem->LoadState(SaveObject);
+
+            if (UGameCalendarSubsystem* Calendar = GameInstance->GetSubsystem<UGameCalendarSubsystem>())
+            {
+                Calendar->ResetTo(TimeSubsystem->GetCurrentMonth());
+            }
+        }
+
         if (USongManagerSubsystem* SongManager = GameInstance->GetSubsystem<USongManagerSubsystem>())
         {
             SongManager->LoadState(SaveObject);
@@ -104,9 +138,9 @@ void UMusicSaveSubsystem::LoadGame(const FString& SlotName)
             ArtistManager->LoadState(SaveObject);
         }
 
-        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        if (UEventSubsystem* EventSubsystem = GameInstance->GetSubsystem<UEventSubsystem>())
         {
-            TimeSubsystem->LoadState(SaveObject);
+            EventSubsystem->LoadState(SaveObject);
         }
 
         if (UUIManagerSubsystem* UIManager = GameInstance->GetSubsystem<UUIManagerSubsystem>())
@@ -6,12 +6,15 @@
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "EventTickerWidget.h"
+#include "NewsTickerScheduler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Types/SlateEnums.h"
 
 DEFINE_LOG_CATEGORY(LogNewsFeedList);
 
 UNewsFeedList::UNewsFeedList(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , CardPool(*this)
 {
 }
 
@@ -36,7 +39,8 @@ void UNewsFeedList::NativeConstruct()
     {
         if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
         {
-            TimeSubsystem->OnMonthAdvanced.AddDynamic(this, &UNewsFeedList::HandleMonthAdvanced);
+            MonthStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::UI, TEXT("NewsFeedList"),
+                FMonthStageDelegate::CreateUObject(this, &UNewsFeedList::HandleMonthAdvanced));
             TimeSubsystemWeak = TimeSubsystem;
         }
         else
@@ -48,6 +52,19 @@ void UNewsFeedList::NativeConstruct()
     {
         UE_LOG(LogNewsFeedList, Warning, TEXT("NativeConstruct: GameInstance is invalid."));
     }
+
+    PrewarmCards();
+
+    // Show whatever history already exists, e.g. after the layout was rebuilt; a loaded save's history is only
+    // decoded now that the feed needs it.
+    if (UGameInstance* GameInstance = World->GetGameInstance())
+    {
+        if (UEventSubsystem* EventSubsystem = GameInstance->GetSubsystem<UEventSubsystem>())
+        {
+            EventSubsystem->EnsureHistoryLoaded();
+        }
+    }
+    RefreshVisibleCards();
 }
 
 void UNewsFeedList::NativeDestruct()
@@ -59,7 +76,7 @@ void UNewsFeedList::NativeDestruct()
 
     if (UGameTimeSubsystem* TimeSubsystem = TimeSubsystemWeak.Get())
     {
-        TimeSubsystem->OnMonthAdvanced.RemoveDynamic(this, &UNewsFeedList::HandleMonthAdvanced);
+        TimeSubsystem->UnregisterMonthStage(MonthStageHandle);
     }
 
     TimeSubsystemWeak.Reset();
@@ -67,7 +84,14 @@ void UNewsFeedList::NativeDestruct()
     Super::NativeDestruct();
 }
 
-UEventTickerWidget* UNewsFeedList::AddNewsCard(const FMusicNewsEvent& Event)
+void UNewsFeedList::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    CardPool.ReleaseAllSlateResources();
+}
+
+UEventTickerWidget* UNewsFeedList::AddNewsCard(FNewsHandle News)
 {
     if (!ensure(IsInGameThread()))
     {
@@ -75,46 +99,37 @@ UEventTickerWidget* UNewsFeedList::AddNewsCard(const FMusicNewsEvent& Event)
         return nullptr;
     }
 
-    if (!IsValid(FeedContainer))
-    {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: FeedContainer is invalid."));
-        return nullptr;
-    }
-
-    if (!EventTickerWidgetClass)
+    if (!News.IsValid())
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: EventTickerWidgetClass is not set."));
+        UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: News handle is invalid."));
         return nullptr;
     }
 
-    UWorld* const World = GetWorld();
-    if (!IsValid(World))
+    const FNewsStore* Store = GetNewsStore();
+    if (!Store)
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: World is invalid."));
         return nullptr;
     }
 
-    UEventTickerWidget* const NewCard = CreateWidget<UEventTickerWidget>(World, EventTickerWidgetClass);
-    if (!IsValid(NewCard))
+    // Only items the feed has seen go past can be revealed; anything the history has since dropped is ignored.
+    SyncWithNewsStore(*Store);
+    if (News.Sequence >= FirstTracked && News.Sequence < NextUntracked && !Entries.Contains(News.Sequence))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: Failed to create event ticker widget."));
-        return nullptr;
+        if (const FNewsRecord* Record = Store->Find(News))
+        {
+            TrackNews(News.Sequence, *Record);
+        }
     }
 
-    NewCard->SetNewsEvent(Event);
-
-    if (UVerticalBoxSlot* const slot = FeedContainer->AddChildToVerticalBox(NewCard))
-    {
-       slot->SetHorizontalAlignment(HAlign_Fill);
-        return NewCard;
-    }
+    RefreshVisibleCards();
 
-    UE_LOG(LogNewsFeedList, Warning, TEXT("AddNewsCard: Failed to add card to container."));
-    if (IsValid(NewCard))
+    for (UEventTickerWidget* Card : Cards)
     {
-        NewCard->RemoveFromParent();
+        if (Card->GetNewsHandle() == News && Card->IsVisible())
+        {
+            return Card;
+        }
     }
-
     return nullptr;
 }
 
@@ -126,25 +141,29 @@ bool UNewsFeedList::RemoveNewsCard(UEventTickerWidget* Card)
         return false;
     }
 
-    if (!IsValid(FeedContainer))
+    if (!IsValid(Card))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("RemoveNewsCard: FeedContainer is invalid."));
+        UE_LOG(LogNewsFeedList, Warning, TEXT("RemoveNewsCard: Card is invalid."));
         return false;
     }
 
-    if (!IsValid(Card))
+    if (!Cards.Contains(Card))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("RemoveNewsCard: Card is invalid."));
+        UE_LOG(LogNewsFeedList, Verbose, TEXT("RemoveNewsCard: Card is not part of the feed."));
         return false;
     }
 
-    if (!FeedContainer->HasChild(Card))
+    FFeedEntry Entry;
+    if (!Entries.RemoveAndCopyValue(Card->GetNewsHandle().Sequence, Entry))
     {
-        UE_LOG(LogNewsFeedList, Verbose, TEXT("RemoveNewsCard: Card is not a child of the feed."));
         return false;
     }
 
-    return FeedContainer->RemoveChild(Card);
+    RemoveFromOrders(Card->GetNewsHandle().Sequence, Entry);
+    bFilterDirty = true;
+
+    RefreshVisibleCards();
+    return true;
 }
 
 bool UNewsFeedList::MoveNewsCardToTop(UEventTickerWidget* Card)
@@ -155,78 +174,373 @@ bool UNewsFeedList::MoveNewsCardToTop(UEventTickerWidget* Card)
         return false;
     }
 
-    if (!IsValid(FeedContainer))
+    if (!IsValid(Card))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: FeedContainer is invalid."));
+        UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: Card is invalid."));
         return false;
     }
 
-    if (!IsValid(Card))
+    if (!Cards.Contains(Card))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: Card is invalid."));
+        UE_LOG(LogNewsFeedList, Verbose, TEXT("MoveNewsCardToTop: Card not found in feed."));
         return false;
     }
 
-    const int32 ChildIndex = FeedContainer->GetChildIndex(Card);
-    if (ChildIndex == INDEX_NONE)
+    const uint32 Sequence = Card->GetNewsHandle().Sequence;
+    FFeedEntry* Entry = Entries.Find(Sequence);
+    if (!Entry)
     {
-        UE_LOG(LogNewsFeedList, Verbose, TEXT("MoveNewsCardToTop: Card not found in feed."));
         return false;
     }
 
-    if (ChildIndex == 0)
+    RemoveFromOrders(Sequence, *Entry);
+    Entry->PinStamp = NextPinStamp++;
+    AddToOrders(Sequence, *Entry);
+    ScrollOffset = 0;
+    bFilterDirty = true;
+
+    RefreshVisibleCards();
+    return true;
+}
+
+void UNewsFeedList::ScrollFeed(int32 Delta)
+{
+    const int32 MaxOffset = FMath::Max(GetNumFeedItems() - VisibleCardCount, 0);
+    const int32 NewOffset = FMath::Clamp(ScrollOffset + Delta, 0, MaxOffset);
+    if (NewOffset != ScrollOffset)
     {
-        return true;
+        ScrollOffset = NewOffset;
+        RefreshVisibleCards();
     }
+}
+
+int32 UNewsFeedList::GetNumFeedItems() const
+{
+    return bFiltered ? FilteredNews.Num() : GetActiveOrder().Num();
+}
 
-    if (!FeedContainer->RemoveChild(Card))
+void UNewsFeedList::SetSortMode(ENewsFeedSortMode InSortMode)
+{
+    if (SortMode == InSortMode)
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: Failed to remove card from feed."));
-        return false;
+        return;
     }
 
-    if (!IsValid(Card))
+    // Both orders are always up to date, so switching is just a matter of reading the other one.
+    SortMode = InSortMode;
+    ScrollOffset = 0;
+    bFilterDirty = true;
+    RefreshVisibleCards();
+}
+
+void UNewsFeedList::SetFilter(const FNewsQuery& Query)
+{
+    Filter = Query;
+    bFiltered = !Filter.IsEmpty();
+    bFilterDirty = true;
+    ScrollOffset = 0;
+    RefreshVisibleCards();
+}
+
+void UNewsFeedList::ClearFilter()
+{
+    SetFilter(FNewsQuery());
+}
+
+FReply UNewsFeedList::NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
+{
+    ScrollFeed(InMouseEvent.GetWheelDelta() > 0.f ? -1 : 1);
+    return FReply::Handled();
+}
+
+void UNewsFeedList::RefreshVisibleCards()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UNewsFeedList::RefreshVisibleCards);
+
+    const FNewsStore* Store = GetNewsStore();
+    if (!Store || !IsValid(FeedContainer))
     {
-        UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: Card became invalid after removal."));
-        return false;
+        return;
+    }
+
+    SyncWithNewsStore(*Store);
+
+    if (bFiltered && bFilterDirty)
+    {
+        UpdateFilteredNews(*Store);
     }
 
-    if (UPanelSlot* PanelSlot = FeedContainer->InsertChildAt(0, Card))
+    ScrollOffset = FMath::Clamp(ScrollOffset, 0, FMath::Max(GetNumFeedItems() - VisibleCardCount, 0));
+
+    const FNewsFeedOrder& Order = GetActiveOrder();
+    const int32 NumItems = GetNumFeedItems();
+    TArray<FNewsHandle, TInlineAllocator<64>> Window;
+    for (int32 Position = ScrollOffset; Position < NumItems && Window.Num() < VisibleCardCount; ++Position)
+    {
+        Window.Add(bFiltered ? FilteredNews[Position] : Order.GetAt(Position));
+    }
+
+    while (Cards.Num() > Window.Num())
+    {
+        ReleaseCard(Cards.Pop(EAllowShrinking::No));
+    }
+
+    while (Cards.Num() < Window.Num())
     {
-        if (UVerticalBoxSlot* slot = Cast<UVerticalBoxSlot>(PanelSlot))
+        if (!AcquireCard())
         {
-            slot->SetHorizontalAlignment(HAlign_Fill);
+            break;
         }
-        return true;
     }
 
+    for (int32 CardIndex = 0; CardIndex < Cards.Num(); ++CardIndex)
+    {
+        // Cards already showing their item are left alone so nothing re-renders for them.
+        UEventTickerWidget* Card = Cards[CardIndex];
+        if (Card->GetNewsHandle() != Window[CardIndex])
+        {
+            Card->SetNewsEvent(Window[CardIndex]);
+        }
+    }
+}
+
+int32 UNewsFeedList::GetFeedPriority(const FNewsRecord& Record)
+{
+    const int32 TypePriority = FNewsTickerScheduler::GetTypePriority(Record.NewsType);
+
+    // Reputation swings break ties within a type; they never lift an item above a more important type.
+    return TypePriority * 100 + FMath::Min(FMath::Abs(Record.ReputationDelta), 99);
+}
+
+FNewsFeedKey UNewsFeedList::MakeKey(uint32 Sequence, const FFeedEntry& Entry, ENewsFeedSortMode Mode) const
+{
+    FNewsFeedKey Key;
+    Key.Sequence = Sequence;
+    if (Entry.PinStamp > 0)
+    {
+        Key.Tier = 0;
+        Key.Rank = Entry.PinStamp;
+    }
+    else
+    {
+        Key.Tier = 1;
+        Key.Rank = Mode == ENewsFeedSortMode::Priority ? Entry.Priority : 0;
+    }
+    return Key;
+}
+
+const FNewsFeedOrder& UNewsFeedList::GetActiveOrder() const
+{
+    return SortMode == ENewsFeedSortMode::Priority ? PriorityOrder : RecencyOrder;
+}
+
+void UNewsFeedList::AddToOrders(uint32 Sequence, const FFeedEntry& Entry)
+{
+    RecencyOrder.Add(MakeKey(Sequence, Entry, ENewsFeedSortMode::Recency));
+    PriorityOrder.Add(MakeKey(Sequence, Entry, ENewsFeedSortMode::Priority));
+}
+
+void UNewsFeedList::RemoveFromOrders(uint32 Sequence, const FFeedEntry& Entry)
+{
+    RecencyOrder.Remove(MakeKey(Sequence, Entry, ENewsFeedSortMode::Recency));
+    PriorityOrder.Remove(MakeKey(Sequence, Entry, ENewsFeedSortMode::Priority));
+}
+
+void UNewsFeedList::SyncWithNewsStore(const FNewsStore& Store)
+{
+    const uint32 StoreNext = Store.GetNewestHandle().Sequence + 1;
+    const uint32 StoreOldest = Store.Num() > 0 ? Store.GetOldestHandle().Sequence : StoreNext;
+
+    // The history was reset and its sequences start over; nothing the feed knows is valid any more.
+    if (StoreNext < NextUntracked)
+    {
+        RecencyOrder.Reset();
+        PriorityOrder.Reset();
+        Entries.Reset();
+        FirstTracked = NextUntracked = StoreOldest;
+        ScrollOffset = 0;
+        bHasSynced = false;
+    }
 
+    // Items above the first card shift the window when they come or go; a reader scrolled down keeps looking
+    // at the same items.
+    for (uint32 Sequence = FirstTracked; Sequence < StoreOldest && Sequence < NextUntracked; ++Sequence)
+    {
+        FFeedEntry Entry;
+        if (Entries.RemoveAndCopyValue(Sequence, Entry))
+        {
+            bFilterDirty = true;
+            if (!bFiltered && ScrollOffset > 0 && GetActiveOrder().GetPosition(MakeKey(Sequence, Entry, SortMode)) < ScrollOffset)
+            {
+                --ScrollOffset;
+            }
+            RemoveFromOrders(Sequence, Entry);
+        }
+    }
+    FirstTracked = FMath::Max(FirstTracked, StoreOldest);
+    NextUntracked = FMath::Max(NextUntracked, FirstTracked);
 
-    UE_LOG(LogNewsFeedList, Warning, TEXT("MoveNewsCardToTop: Failed to insert card at top."));
-    return false;
+    // The history that exists when the feed first looks is shown at once. Anything posted later waits for
+    // AddNewsCard, so the layout's ticker decides when it appears or whether it is rolled up.
+    if (!bHasSynced)
+    {
+        for (uint32 Sequence = NextUntracked; Sequence < StoreNext; ++Sequence)
+        {
+            FNewsHandle News;
+            News.Sequence = Sequence;
+            // Items a roundup stands for are left to the roundup.
+            const FNewsRecord* Record = Store.Find(News);
+            if (Record && !Record->bRolledUp)
+            {
+                TrackNews(Sequence, *Record);
+            }
+        }
+        bHasSynced = true;
+    }
+    NextUntracked = StoreNext;
 }
 
-void UNewsFeedList::HandleMonthAdvanced(const FDateTime& NewDate)
+void UNewsFeedList::TrackNews(uint32 Sequence, const FNewsRecord& Record)
 {
+    FFeedEntry Entry;
+    Entry.Priority = GetFeedPriority(Record);
+    Entries.Add(Sequence, Entry);
+    AddToOrders(Sequence, Entry);
+    bFilterDirty = true;
+
+    if (!bFiltered && ScrollOffset > 0 && GetActiveOrder().GetPosition(MakeKey(Sequence, Entry, SortMode)) < ScrollOffset)
+    {
+        ++ScrollOffset;
+    }
+}
+
+void UNewsFeedList::UpdateFilteredNews(const FNewsStore& Store)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UNewsFeedList::UpdateFilteredNews);
+
+    Store.Query(Filter, FilteredNews);
+
+    // The store knows nothing of removals, roundups or pins. Only items the feed tracks stay, which leaves out
+    // the removed and rolled-up ones, and the rest are sorted the way the feed would.
+    FilteredNews.RemoveAll([this, &Store](const FNewsHandle& News)
+    {
+        const FNewsRecord* Record = Store.Find(News);
+        return !Record || Record->bRolledUp || !Entries.Contains(News.Sequence);
+    });
+    if (SortMode != ENewsFeedSortMode::Recency || NextPinStamp > 1)
+    {
+        FilteredNews.Sort([this](const FNewsHandle& A, const FNewsHandle& B)
+        {
+            return MakeKey(A.Sequence, Entries[A.Sequence], SortMode) < MakeKey(B.Sequence, Entries[B.Sequence], SortMode);
+        });
+    }
+
+    bFilterDirty = false;
+}
+
+void UNewsFeedList::PrewarmCards()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UNewsFeedList::PrewarmCards);
+
+    if (!EventTickerWidgetClass)
+    {
+        UE_LOG(LogNewsFeedList, Warning, TEXT("PrewarmCards: EventTickerWidgetClass is not set."));
+        return;
+    }
+
+    // The pool hands back released cards first, so taking the full count and releasing it creates only the shortfall.
+    TArray<UUserWidget*, TInlineAllocator<64>> Prewarmed;
+    for (int32 CardIndex = Cards.Num(); CardIndex < VisibleCardCount; ++CardIndex)
+    {
+        if (UEventTickerWidget* Card = CardPool.GetOrCreateInstance<UEventTickerWidget>(EventTickerWidgetClass))
+        {
+            Prewarmed.Add(Card);
+        }
+    }
+
+    for (UUserWidget* Card : Prewarmed)
+    {
+        CardPool.Release(Card);
+    }
+}
+
+UEventTickerWidget* UNewsFeedList::AcquireCard()
+{
+    if (!EventTickerWidgetClass)
+    {
+        UE_LOG(LogNewsFeedList, Warning, TEXT("AcquireCard: EventTickerWidgetClass is not set."));
+        return nullptr;
+    }
+
+    UEventTickerWidget* const Card = CardPool.GetOrCreateInstance<UEventTickerWidget>(EventTickerWidgetClass);
+    if (!IsValid(Card))
+    {
+        UE_LOG(LogNewsFeedList, Warning, TEXT("AcquireCard: Failed to create event ticker widget."));
+        return nullptr;
+    }
+
+    UVerticalBoxSlot* const slot = FeedContainer->AddChildToVerticalBox(Card);
+    if (!slot)
+    {
+        UE_LOG(LogNewsFeedList, Warning, TEXT("AcquireCard: Failed to add card to container."));
+        CardPool.Release(Card);
+        return nullptr;
+    }
+
+    slot->SetHorizontalAlignment(HAlign_Fill);
+    Cards.Add(Card);
+    OnCardAcquired.Broadcast(Card);
+    return Card;
+}
+
+void UNewsFeedList::ReleaseCard(UEventTickerWidget* Card)
+{
+    if (!IsValid(Card))
+    {
+        return;
+    }
+
+    Card->RemoveFromParent();
+    CardPool.Release(Card);
+}
+
+const FNewsStore* UNewsFeedList::GetNewsStore() const
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    const UEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UEventSubsystem>() : nullptr;
+    return EventSubsystem ? &EventSubsystem->GetNewsStore() : nullptr;
+}
+
+bool UNewsFeedList::HandleMonthAdvanced(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UNewsFeedList::HandleMonthAdvanced);
+
     if (!ensure(IsInGameThread()))
     {
         UE_LOG(LogNewsFeedList, Warning, TEXT("HandleMonthAdvanced called off the game thread."));
-        return;
+        return true;
     }
 
     // Minimal integration example: create a synthetic news item whenever the centralized
-    // time subsystem advances the simulation by one month.
+    // time subsystem advances the simulation by one month. The text comes from the recap template when
+    // the item is shown, so nothing is formatted here.
     FMusicNewsEvent NewEvent;
     NewEvent.NewsId = FGuid::NewGuid();
-    NewEvent.Timestamp = NewDate;
+    NewEvent.Timestamp = NewMonth.ToDateTime();
     NewEvent.NewsType = EMusicNewsType::IndustryTrend;
-
-    const FString MonthYearString = NewDate.ToString(TEXT("%B %Y"));
+    NewEvent.TextTemplate = ENewsTextTemplate::MarketRecap;
     NewEvent.SourceName = TEXT("Global Market Desk");
-    NewEvent.SubjectName = MonthYearString;
-    NewEvent.Headline = FString::Printf(TEXT("%s Market Recap Released"), *MonthYearString);
-    NewEvent.BodyText = FString::Printf(TEXT("UGameTimeSubsystem broadcasted the arrival of %s, triggering an automatic news feed refresh."), *MonthYearString);
     NewEvent.Tags = { TEXT("Auto"), TEXT("TimeSubsystem") };
 
-    AddNewsCard(NewEvent);
+    // Posted through the event subsystem so the recap joins the history and reaches the feed via the layout.
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (UEventSubsystem* EventSubsystem = GameInstance->GetSubsystem<UEventSubsystem>())
+        {
+            EventSubsystem->PostNews(NewEvent);
+        }
+    }
+
+    Cursor = Cards.Num();
+    return true;
 }
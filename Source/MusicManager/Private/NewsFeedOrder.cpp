@@ -0,0 +1,162 @@
+#include "NewsFeedOrder.h"
+
+void FNewsFeedOrder::Add(const FNewsFeedKey& Key)
+{
+    int32 NodeIndex = INDEX_NONE;
+    if (FreeNodes.Num() > 0)
+    {
+        NodeIndex = FreeNodes.Pop(EAllowShrinking::No);
+        Nodes[NodeIndex] = FNode();
+    }
+    else
+    {
+        NodeIndex = Nodes.AddDefaulted();
+    }
+
+    // Heap priorities only need to look random; hashing the key keeps the shape reproducible.
+    FNode& Node = Nodes[NodeIndex];
+    Node.Key = Key;
+    Node.HeapPriority = MurmurFinalize32(HashCombine(Key.Sequence, static_cast<uint32>(Key.Rank) ^ Key.Tier));
+
+    int32 Left = INDEX_NONE;
+    int32 Right = INDEX_NONE;
+    Split(Root, Key, Left, Right);
+    Root = Merge(Merge(Left, NodeIndex), Right);
+}
+
+bool FNewsFeedOrder::Remove(const FNewsFeedKey& Key)
+{
+    int32* Link = &Root;
+    while (*Link != INDEX_NONE)
+    {
+        FNode& Node = Nodes[*Link];
+        if (Node.Key == Key)
+        {
+            const int32 Removed = *Link;
+            *Link = Merge(Node.Left, Node.Right);
+            FreeNodes.Add(Removed);
+
+            // Everything on the path down to the removed node lost one descendant.
+            for (int32 Walk = Root; Walk != INDEX_NONE && Walk != *Link;)
+            {
+                FNode& PathNode = Nodes[Walk];
+                --PathNode.Size;
+                Walk = Key < PathNode.Key ? PathNode.Left : PathNode.Right;
+            }
+            return true;
+        }
+        Link = Key < Node.Key ? &Node.Left : &Node.Right;
+    }
+    return false;
+}
+
+FNewsHandle FNewsFeedOrder::GetAt(int32 Position) const
+{
+    FNewsHandle Handle;
+    if (Position < 0 || Position >= Num())
+    {
+        return Handle;
+    }
+
+    int32 NodeIndex = Root;
+    while (NodeIndex != INDEX_NONE)
+    {
+        const FNode& Node = Nodes[NodeIndex];
+        const int32 LeftSize = GetSize(Node.Left);
+        if (Position < LeftSize)
+        {
+            NodeIndex = Node.Left;
+        }
+        else if (Position == LeftSize)
+        {
+            Handle.Sequence = Node.Key.Sequence;
+            break;
+        }
+        else
+        {
+            Position -= LeftSize + 1;
+            NodeIndex = Node.Right;
+        }
+    }
+    return Handle;
+}
+
+int32 FNewsFeedOrder::GetPosition(const FNewsFeedKey& Key) const
+{
+    int32 Position = 0;
+    int32 NodeIndex = Root;
+    while (NodeIndex != INDEX_NONE)
+    {
+        const FNode& Node = Nodes[NodeIndex];
+        if (Node.Key < Key)
+        {
+            Position += GetSize(Node.Left) + 1;
+            NodeIndex = Node.Right;
+        }
+        else
+        {
+            NodeIndex = Node.Left;
+        }
+    }
+    return Position;
+}
+
+void FNewsFeedOrder::Reset()
+{
+    Nodes.Reset();
+    FreeNodes.Reset();
+    Root = INDEX_NONE;
+}
+
+void FNewsFeedOrder::UpdateSize(int32 Node)
+{
+    if (Node != INDEX_NONE)
+    {
+        Nodes[Node].Size = 1 + GetSize(Nodes[Node].Left) + GetSize(Nodes[Node].Right);
+    }
+}
+
+void FNewsFeedOrder::Split(int32 Node, const FNewsFeedKey& Key, int32& OutLeft, int32& OutRight)
+{
+    if (Node == INDEX_NONE)
+    {
+        OutLeft = INDEX_NONE;
+        OutRight = INDEX_NONE;
+        return;
+    }
+
+    if (Nodes[Node].Key < Key)
+    {
+        Split(Nodes[Node].Right, Key, Nodes[Node].Right, OutRight);
+        OutLeft = Node;
+    }
+    else
+    {
+        Split(Nodes[Node].Left, Key, OutLeft, Nodes[Node].Left);
+        OutRight = Node;
+    }
+    UpdateSize(Node);
+}
+
+int32 FNewsFeedOrder::Merge(int32 Left, int32 Right)
+{
+    if (Left == INDEX_NONE)
+    {
+        return Right;
+    }
+    if (Right == INDEX_NONE)
+    {
+        return Left;
+    }
+
+    if (Nodes[Left].HeapPriority > Nodes[Right].HeapPriority)
+    {
+        Nodes[Left].Right = Merge(Nodes[Left].Right, Right);
+        UpdateSize(Left);
+        return Left;
+    }
+
+    Nodes[Right].Left = Merge(Left, Nodes[Right].Left);
+    UpdateSize(Right);
+    return Right;
+}
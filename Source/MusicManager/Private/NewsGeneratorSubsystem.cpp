@@ -0,0 +1,188 @@
+#include "NewsGeneratorSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "EventSubsystem.h"
+#include "GameTimeSubsystem.h"
+#include "MusicManagerStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_CYCLE_STAT(TEXT("News EmitMonthNews"), STAT_NewsEmitMonthNews, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("News Candidates"), STAT_NewsCandidates, STATGROUP_MusicSimulation);
+
+namespace
+{
+    FMusicNewsEvent MakeNewsEvent(const FNewsCandidate& Candidate, const FDateTime& Timestamp)
+    {
+        FMusicNewsEvent Event;
+        Event.NewsId = FGuid::NewGuid();
+        Event.Timestamp = Timestamp;
+        Event.SubjectName = Candidate.SubjectName;
+        Event.Metadata.Add(TEXT("SubjectId"), Candidate.SubjectId);
+
+        // Headline and body come from the template when the item is shown; nothing is formatted on the month path.
+        Event.TextAmount = Candidate.Amount;
+
+        switch (Candidate.Kind)
+        {
+        case ENewsCandidateKind::NumberOne:
+            Event.NewsType = EMusicNewsType::ChartAchievement;
+            Event.TextTemplate = ENewsTextTemplate::ChartNumberOne;
+            Event.SourceName = TEXT("Chart Desk");
+            Event.Tags = { TEXT("Charts") };
+            Event.ReputationDelta = 10;
+            break;
+
+        case ENewsCandidateKind::ChartEntry:
+            Event.NewsType = EMusicNewsType::ChartAchievement;
+            Event.TextTemplate = ENewsTextTemplate::ChartEntry;
+            Event.SourceName = TEXT("Chart Desk");
+            Event.Tags = { TEXT("Charts") };
+            Event.ReputationDelta = 2;
+            break;
+
+        case ENewsCandidateKind::ArtistSigned:
+            Event.NewsType = EMusicNewsType::ArtistSigned;
+            Event.TextTemplate = ENewsTextTemplate::ArtistSigned;
+            Event.SourceName = TEXT("Label Office");
+            Event.Tags = { TEXT("Signings") };
+            Event.RevenueDelta = -FMath::RoundToInt(Candidate.Amount);
+            break;
+
+        case ENewsCandidateKind::ContractExpired:
+            Event.NewsType = EMusicNewsType::ArtistDropped;
+            Event.TextTemplate = ENewsTextTemplate::ContractExpired;
+            Event.SourceName = TEXT("Label Office");
+            Event.Tags = { TEXT("Contracts") };
+            break;
+
+        case ENewsCandidateKind::RecordDelivered:
+            Event.NewsType = EMusicNewsType::RecordRelease;
+            Event.TextTemplate = ENewsTextTemplate::RecordDelivered;
+            Event.SourceName = TEXT("Studio Report");
+            Event.Tags = { TEXT("Records") };
+            break;
+
+        case ENewsCandidateKind::RevenueMilestone:
+            Event.NewsType = EMusicNewsType::FinancialReport;
+            Event.TextTemplate = ENewsTextTemplate::RevenueMilestone;
+            Event.SourceName = TEXT("Finance Desk");
+            Event.Tags = { TEXT("Finance") };
+            break;
+        }
+
+        if (!Candidate.Genre.IsEmpty())
+        {
+            Event.Tags.Add(Candidate.Genre);
+        }
+
+        return Event;
+    }
+}
+
+void UNewsGeneratorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Collection.InitializeDependency<UEventSubsystem>();
+
+    if (UGameTimeSubsystem* TimeSubsystem = Collection.InitializeDependency<UGameTimeSubsystem>())
+    {
+        // After the publish stages at order zero, which hand in the month's candidates.
+        MonthStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::News, TEXT("NewsGenerator"),
+            FMonthStageDelegate::CreateUObject(this, &UNewsGeneratorSubsystem::EmitMonthNews),
+            EMonthStageThread::GameThread, 1);
+    }
+}
+
+void UNewsGeneratorSubsystem::Deinitialize()
+{
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            TimeSubsystem->UnregisterMonthStage(MonthStageHandle);
+        }
+    }
+
+    Candidates.Empty();
+
+    Super::Deinitialize();
+}
+
+void UNewsGeneratorSubsystem::AddCandidate(FNewsCandidate&& Candidate)
+{
+    check(IsInGameThread());
+
+    Candidates.Add(MoveTemp(Candidate));
+}
+
+float UNewsGeneratorSubsystem::ScoreCandidate(const FNewsCandidate& Candidate)
+{
+    float BaseScore = 0.f;
+    switch (Candidate.Kind)
+    {
+    case ENewsCandidateKind::NumberOne:        BaseScore = 100.f; break;
+    case ENewsCandidateKind::RevenueMilestone: BaseScore = 70.f; break;
+    case ENewsCandidateKind::ArtistSigned:     BaseScore = 60.f; break;
+    case ENewsCandidateKind::ChartEntry:       BaseScore = 40.f; break;
+    case ENewsCandidateKind::RecordDelivered:  BaseScore = 35.f; break;
+    case ENewsCandidateKind::ContractExpired:  BaseScore = 30.f; break;
+    }
+
+    // Magnitude only reorders candidates within a kind and the ones next to it, never a #1 below a deal.
+    return BaseScore + FMath::Clamp(Candidate.Magnitude, 0.f, 100.f) * 0.25f;
+}
+
+bool UNewsGeneratorSubsystem::EmitMonthNews(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    check(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(UNewsGeneratorSubsystem::EmitMonthNews);
+    SCOPE_CYCLE_COUNTER(STAT_NewsEmitMonthNews);
+
+    SET_DWORD_STAT(STAT_NewsCandidates, Candidates.Num());
+    Cursor = Candidates.Num();
+
+    if (Candidates.Num() == 0)
+    {
+        return true;
+    }
+
+    // Keep the best candidate per subject. Earlier candidates win ties so the result does not depend on hashing.
+    BestBySubject.Reset();
+    Ranked.Reset();
+    for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex)
+    {
+        const float Score = ScoreCandidate(Candidates[CandidateIndex]);
+        if (int32* BestIndex = BestBySubject.Find(Candidates[CandidateIndex].SubjectId))
+        {
+            if (Score > Ranked[*BestIndex].Key)
+            {
+                Ranked[*BestIndex] = TPair<float, int32>(Score, CandidateIndex);
+            }
+            continue;
+        }
+
+        BestBySubject.Add(Candidates[CandidateIndex].SubjectId, Ranked.Num());
+        Ranked.Emplace(Score, CandidateIndex);
+    }
+
+    Ranked.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+    {
+        return A.Key != B.Key ? A.Key > B.Key : A.Value < B.Value;
+    });
+
+    UGameInstance* GameInstance = GetGameInstance();
+    UEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UEventSubsystem>() : nullptr;
+    if (IsValid(EventSubsystem))
+    {
+        const FDateTime Timestamp = NewMonth.ToDateTime();
+        const int32 NumToPost = FMath::Min(MaxNewsPerMonth, Ranked.Num());
+        for (int32 RankIndex = 0; RankIndex < NumToPost; ++RankIndex)
+        {
+            EventSubsystem->PostNews(MakeNewsEvent(Candidates[Ranked[RankIndex].Value], Timestamp));
+        }
+    }
+
+    Candidates.Reset();
+    return true;
+}
@@ -0,0 +1,116 @@
+#include "NewsIndex.h"
+
+#include "NewsStore.h"
+
+void FNewsIndex::Init(int32 InNumSlots)
+{
+    NumSlots = InNumSlots;
+    LiveSlots.Init(false, NumSlots);
+    TagSlots.Reset();
+    TypeSlots.Reset();
+    SourceSlots.Reset();
+}
+
+void FNewsIndex::Add(int32 Slot, const FNewsRecord& Record)
+{
+    LiveSlots[Slot] = true;
+
+    for (uint64 Mask = Record.TagMask; Mask != 0; Mask &= Mask - 1)
+    {
+        FindOrAddSlots(TagSlots, static_cast<int32>(FMath::CountTrailingZeros64(Mask)))[Slot] = true;
+    }
+
+    FindOrAddSlots(TypeSlots, static_cast<int32>(Record.NewsType))[Slot] = true;
+
+    if (!Record.Source.IsNone())
+    {
+        FSourceSlots& Source = SourceSlots.FindOrAdd(Record.Source);
+        if (Source.Slots.Num() != NumSlots)
+        {
+            Source.Slots.Init(false, NumSlots);
+        }
+        Source.Slots[Slot] = true;
+        ++Source.Num;
+    }
+}
+
+void FNewsIndex::Remove(int32 Slot, const FNewsRecord& Record)
+{
+    LiveSlots[Slot] = false;
+
+    for (uint64 Mask = Record.TagMask; Mask != 0; Mask &= Mask - 1)
+    {
+        const int32 TagIndex = static_cast<int32>(FMath::CountTrailingZeros64(Mask));
+        if (TagSlots.IsValidIndex(TagIndex))
+        {
+            TagSlots[TagIndex][Slot] = false;
+        }
+    }
+
+    const int32 TypeIndex = static_cast<int32>(Record.NewsType);
+    if (TypeSlots.IsValidIndex(TypeIndex))
+    {
+        TypeSlots[TypeIndex][Slot] = false;
+    }
+
+    if (FSourceSlots* Source = SourceSlots.Find(Record.Source))
+    {
+        Source->Slots[Slot] = false;
+        if (--Source->Num <= 0)
+        {
+            SourceSlots.Remove(Record.Source);
+        }
+    }
+}
+
+const TBitArray<>* FNewsIndex::FindTagSlots(int32 TagIndex) const
+{
+    return TagSlots.IsValidIndex(TagIndex) && TagSlots[TagIndex].Num() == NumSlots ? &TagSlots[TagIndex] : nullptr;
+}
+
+const TBitArray<>* FNewsIndex::FindTypeSlots(EMusicNewsType NewsType) const
+{
+    const int32 TypeIndex = static_cast<int32>(NewsType);
+    return TypeSlots.IsValidIndex(TypeIndex) && TypeSlots[TypeIndex].Num() == NumSlots ? &TypeSlots[TypeIndex] : nullptr;
+}
+
+const TBitArray<>* FNewsIndex::FindSourceSlots(FName Source) const
+{
+    const FSourceSlots* Found = SourceSlots.Find(Source);
+    return Found ? &Found->Slots : nullptr;
+}
+
+SIZE_T FNewsIndex::GetAllocatedSize() const
+{
+    SIZE_T Size = LiveSlots.GetAllocatedSize() + TagSlots.GetAllocatedSize() + TypeSlots.GetAllocatedSize()
+        + SourceSlots.GetAllocatedSize();
+    for (const TBitArray<>& Bitmap : TagSlots)
+    {
+        Size += Bitmap.GetAllocatedSize();
+    }
+    for (const TBitArray<>& Bitmap : TypeSlots)
+    {
+        Size += Bitmap.GetAllocatedSize();
+    }
+    for (const TPair<FName, FSourceSlots>& Source : SourceSlots)
+    {
+        Size += Source.Value.Slots.GetAllocatedSize();
+    }
+    return Size;
+}
+
+TBitArray<>& FNewsIndex::FindOrAddSlots(TArray<TBitArray<>>& Bitmaps, int32 Index)
+{
+    if (Index >= Bitmaps.Num())
+    {
+        Bitmaps.SetNum(Index + 1);
+    }
+
+    // Bitmaps for tags and types no item has used yet stay empty until one does.
+    TBitArray<>& Bitmap = Bitmaps[Index];
+    if (Bitmap.Num() != NumSlots)
+    {
+        Bitmap.Init(false, NumSlots);
+    }
+    return Bitmap;
+}
@@ -0,0 +1,730 @@
+#include "NewsStore.h"
+
+#include "EventSubsystem.h"
+#include "NewsTextTemplates.h"
+#include "Misc/Crc.h"
+#include "Containers/StringConv.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    /** 2 added a flags byte per item. Version 1 chunks still load, with no flags set. */
+    constexpr uint8 NewsHistoryVersion = 2;
+    constexpr uint8 OldestReadableNewsHistoryVersion = 1;
+
+    constexpr uint8 NewsRecordFlagRolledUp = 1 << 0;
+
+    void WriteVarUInt(FArchive& Ar, uint64 Value)
+    {
+        do
+        {
+            uint8 Byte = static_cast<uint8>(Value & 0x7f);
+            Value >>= 7;
+            if (Value != 0)
+            {
+                Byte |= 0x80;
+            }
+            Ar << Byte;
+        }
+        while (Value != 0);
+    }
+
+    uint64 ReadVarUInt(FArchive& Ar)
+    {
+        uint64 Value = 0;
+        for (int32 Shift = 0; Shift < 64 && !Ar.IsError(); Shift += 7)
+        {
+            uint8 Byte = 0;
+            Ar << Byte;
+            Value |= static_cast<uint64>(Byte & 0x7f) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        return Value;
+    }
+
+    void WriteVarInt(FArchive& Ar, int64 Value)
+    {
+        WriteVarUInt(Ar, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+    }
+
+    int64 ReadVarInt(FArchive& Ar)
+    {
+        const uint64 Encoded = ReadVarUInt(Ar);
+        return static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+    }
+
+    void WriteUtf8(FArchive& Ar, FUtf8StringView Text)
+    {
+        WriteVarUInt(Ar, Text.Len());
+        Ar.Serialize(const_cast<UTF8CHAR*>(Text.GetData()), Text.Len() * sizeof(UTF8CHAR));
+    }
+
+    void ReadUtf8(FArchive& Ar, TArray<UTF8CHAR>& OutText)
+    {
+        const uint64 Length = ReadVarUInt(Ar);
+        if (Ar.IsError() || Length > static_cast<uint64>(Ar.TotalSize() - Ar.Tell()))
+        {
+            Ar.SetError();
+            OutText.Reset();
+            return;
+        }
+        OutText.SetNumUninitialized(static_cast<int32>(Length));
+        Ar.Serialize(OutText.GetData(), Length * sizeof(UTF8CHAR));
+    }
+}
+
+void FNewsStore::SetCapacity(int32 InCapacity)
+{
+    check(IsInGameThread());
+
+    InCapacity = FMath::Max(InCapacity, 1);
+    if (InCapacity == Capacity)
+    {
+        return;
+    }
+
+    // Slots depend on the capacity, so the kept items are laid out again, newest ones first to survive.
+    const int32 NumKept = FMath::Min(NumRecords, InCapacity);
+    const uint32 FirstKept = NextSequence - static_cast<uint32>(NumKept);
+
+    TArray<FNewsRecord> OldRecords = MoveTemp(Records);
+    const int32 OldCapacity = Capacity;
+
+    Capacity = InCapacity;
+    NumRecords = NumKept;
+    Records.SetNum(FMath::Min(Capacity, static_cast<int32>(NextSequence - 1)));
+
+    for (uint32 Sequence = FirstKept; Sequence < NextSequence; ++Sequence)
+    {
+        Records[GetSlot(Sequence)] = OldRecords[static_cast<int32>((Sequence - 1) % static_cast<uint32>(OldCapacity))];
+    }
+
+    Index.Init(Capacity);
+    for (uint32 Sequence = FirstKept; Sequence < NextSequence; ++Sequence)
+    {
+        Index.Add(GetSlot(Sequence), Records[GetSlot(Sequence)]);
+    }
+
+    Compact();
+}
+
+FNewsHandle FNewsStore::Add(const FMusicNewsEvent& Event)
+{
+    check(IsInGameThread());
+
+    FNewsRecord Record;
+    Record.TimestampTicks = Event.Timestamp.GetTicks();
+    Record.NewsType = Event.NewsType;
+    Record.Source = FName(*Event.SourceName);
+    Record.Subject = InternText(Event.SubjectName);
+    Record.Headline = InternText(Event.Headline);
+    Record.Body = InternText(Event.BodyText);
+    Record.TagMask = InternTags(Event.Tags);
+    Record.ReputationDelta = Event.ReputationDelta;
+    Record.RevenueDelta = Event.RevenueDelta;
+    Record.TextTemplate = Event.TextTemplate;
+    Record.TextAmount = Event.TextAmount;
+
+    Record.FirstMetadata = static_cast<uint32>(Metadata.Num());
+    for (const TPair<FString, FString>& Entry : Event.Metadata)
+    {
+        if (Record.NumMetadata == MAX_uint16)
+        {
+            break;
+        }
+        Metadata.Add({ FName(*Entry.Key), InternText(Entry.Value) });
+        ++Record.NumMetadata;
+    }
+
+    return AddRecord(Record);
+}
+
+FNewsHandle FNewsStore::AddRecord(const FNewsRecord& Record)
+{
+    const uint32 Sequence = NextSequence++;
+    const int32 Slot = GetSlot(Sequence);
+    if (Slot >= Records.Num())
+    {
+        Records.SetNum(Slot + 1);
+    }
+
+    if (Index.GetLiveSlots().Num() != Capacity)
+    {
+        Index.Init(Capacity);
+    }
+
+    if (NumRecords == Capacity)
+    {
+        Index.Remove(Slot, Records[Slot]);
+        ++NumEvictedSinceCompact;
+    }
+    else
+    {
+        ++NumRecords;
+    }
+
+    Records[Slot] = Record;
+    Index.Add(Slot, Record);
+
+    // Evicted items leave their text behind; once as much has been evicted as the ring holds, reclaim it.
+    if (NumEvictedSinceCompact >= Capacity)
+    {
+        Compact();
+    }
+
+    FNewsHandle Handle;
+    Handle.Sequence = Sequence;
+    return Handle;
+}
+
+const FNewsRecord* FNewsStore::Find(FNewsHandle Handle) const
+{
+    if (Handle.Sequence == 0 || Handle.Sequence >= NextSequence || NextSequence - Handle.Sequence > static_cast<uint32>(NumRecords))
+    {
+        return nullptr;
+    }
+    return &Records[GetSlot(Handle.Sequence)];
+}
+
+void FNewsStore::MarkRolledUp(FNewsHandle Handle)
+{
+    if (Find(Handle))
+    {
+        Records[GetSlot(Handle.Sequence)].bRolledUp = true;
+    }
+}
+
+FNewsHandle FNewsStore::GetNewestHandle() const
+{
+    FNewsHandle Handle;
+    Handle.Sequence = NumRecords > 0 ? NextSequence - 1 : 0;
+    return Handle;
+}
+
+FNewsHandle FNewsStore::GetOldestHandle() const
+{
+    FNewsHandle Handle;
+    Handle.Sequence = NumRecords > 0 ? NextSequence - static_cast<uint32>(NumRecords) : 0;
+    return Handle;
+}
+
+uint64 FNewsStore::GetTagBit(FName Tag) const
+{
+    const int32* TagIndex = TagIndices.Find(Tag);
+    return TagIndex ? (uint64(1) << *TagIndex) : 0;
+}
+
+int32 FNewsStore::Query(const FNewsQuery& Query, TArray<FNewsHandle>& OutNews, int32 MaxResults) const
+{
+    check(IsInGameThread());
+
+    OutNews.Reset();
+    if (NumRecords == 0)
+    {
+        return 0;
+    }
+
+    QueryMatches = Index.GetLiveSlots();
+
+    for (const FName& Tag : Query.RequiredTags)
+    {
+        const int32* TagIndex = TagIndices.Find(Tag);
+        const TBitArray<>* TagSlots = TagIndex ? Index.FindTagSlots(*TagIndex) : nullptr;
+        if (!TagSlots)
+        {
+            return 0;
+        }
+        QueryMatches.CombineWithBitwiseAND(*TagSlots, EBitwiseOperatorFlags::MaintainSize);
+    }
+
+    for (const FName& Tag : Query.ExcludedTags)
+    {
+        const int32* TagIndex = TagIndices.Find(Tag);
+        if (const TBitArray<>* TagSlots = TagIndex ? Index.FindTagSlots(*TagIndex) : nullptr)
+        {
+            QueryTerm = *TagSlots;
+            QueryTerm.BitwiseNOT();
+            QueryMatches.CombineWithBitwiseAND(QueryTerm, EBitwiseOperatorFlags::MaintainSize);
+        }
+    }
+
+    if (!Query.NewsTypes.IsEmpty())
+    {
+        QueryTerm.Init(false, QueryMatches.Num());
+        for (const EMusicNewsType NewsType : Query.NewsTypes)
+        {
+            if (const TBitArray<>* TypeSlots = Index.FindTypeSlots(NewsType))
+            {
+                QueryTerm.CombineWithBitwiseOR(*TypeSlots, EBitwiseOperatorFlags::MaintainSize);
+            }
+        }
+        QueryMatches.CombineWithBitwiseAND(QueryTerm, EBitwiseOperatorFlags::MaintainSize);
+    }
+
+    if (!Query.Sources.IsEmpty())
+    {
+        QueryTerm.Init(false, QueryMatches.Num());
+        for (const FName& Source : Query.Sources)
+        {
+            if (const TBitArray<>* SourceSlots = Index.FindSourceSlots(Source))
+            {
+                QueryTerm.CombineWithBitwiseOR(*SourceSlots, EBitwiseOperatorFlags::MaintainSize);
+            }
+        }
+        QueryMatches.CombineWithBitwiseAND(QueryTerm, EBitwiseOperatorFlags::MaintainSize);
+    }
+
+    // Time is the only clause without a bitmap; it is checked on the items the others left.
+    const int64 SinceTicks = Query.Since.GetTicks();
+    const int64 UntilTicks = Query.Until.GetTicks();
+    for (TConstSetBitIterator<> It(QueryMatches); It; ++It)
+    {
+        const FNewsRecord& Record = Records[It.GetIndex()];
+        if (Record.TimestampTicks >= SinceTicks && Record.TimestampTicks <= UntilTicks)
+        {
+            FNewsHandle Handle;
+            Handle.Sequence = GetSequence(It.GetIndex());
+            OutNews.Add(Handle);
+        }
+    }
+
+    const int32 NumMatches = OutNews.Num();
+    OutNews.Sort([](const FNewsHandle& A, const FNewsHandle& B) { return A.Sequence > B.Sequence; });
+    if (NumMatches > MaxResults)
+    {
+        OutNews.SetNum(FMath::Max(MaxResults, 0), EAllowShrinking::No);
+    }
+    return NumMatches;
+}
+
+bool FNewsStore::MakeEvent(FNewsHandle Handle, FMusicNewsEvent& OutEvent) const
+{
+    const FNewsRecord* Record = Find(Handle);
+    if (!Record)
+    {
+        return false;
+    }
+
+    // Derived from the handle so the same item always reports the same id.
+    OutEvent.NewsId = FGuid(0x4E455753, 0, 0, Handle.Sequence);
+    OutEvent.Timestamp = FDateTime(Record->TimestampTicks);
+    OutEvent.NewsType = Record->NewsType;
+    OutEvent.SourceName = Record->Source.IsNone() ? FString() : Record->Source.ToString();
+    OutEvent.SubjectName = FString(GetText(Record->Subject));
+    OutEvent.Headline = FString(GetText(Record->Headline));
+    OutEvent.BodyText = FString(GetText(Record->Body));
+    OutEvent.ReputationDelta = Record->ReputationDelta;
+    OutEvent.RevenueDelta = Record->RevenueDelta;
+    OutEvent.TextTemplate = Record->TextTemplate;
+    OutEvent.TextAmount = Record->TextAmount;
+
+    if (Record->TextTemplate != ENewsTextTemplate::None)
+    {
+        OutEvent.Headline = FNewsTextTemplates::FormatHeadline(*Record, *this).ToString();
+        OutEvent.BodyText = FNewsTextTemplates::FormatBody(*Record, *this).ToString();
+    }
+
+    OutEvent.Tags.Reset();
+    ForEachTag(Record->TagMask, [&OutEvent](FName Tag)
+    {
+        OutEvent.Tags.Add(Tag.ToString());
+    });
+
+    OutEvent.Metadata.Reset();
+    for (uint32 EntryIndex = Record->FirstMetadata; EntryIndex < Record->FirstMetadata + Record->NumMetadata; ++EntryIndex)
+    {
+        OutEvent.Metadata.Add(Metadata[EntryIndex].Key.ToString(), FString(GetText(Metadata[EntryIndex].Value)));
+    }
+
+    return true;
+}
+
+void FNewsStore::SaveHistory(TArray<uint8>& OutBytes) const
+{
+    check(IsInGameThread());
+
+    OutBytes.Reset();
+    FMemoryWriter Ar(OutBytes);
+
+    // Tables first, so records are only indices. Arena text is deduplicated, so its offset identifies a string.
+    TMap<uint32, int32> StringIndices;
+    TArray<FNewsText> Strings;
+    TMap<FName, int32> NameIndices;
+    TArray<FName> Names;
+
+    const auto StringRef = [&StringIndices, &Strings](const FNewsText& Text) -> uint64
+    {
+        if (Text.Length == 0)
+        {
+            return 0;
+        }
+        if (const int32* Found = StringIndices.Find(Text.Offset))
+        {
+            return static_cast<uint64>(*Found) + 1;
+        }
+        StringIndices.Add(Text.Offset, Strings.Num());
+        return static_cast<uint64>(Strings.Add(Text)) + 1;
+    };
+
+    const auto NameRef = [&NameIndices, &Names](FName Name) -> uint64
+    {
+        if (Name.IsNone())
+        {
+            return 0;
+        }
+        if (const int32* Found = NameIndices.Find(Name))
+        {
+            return static_cast<uint64>(*Found) + 1;
+        }
+        NameIndices.Add(Name, Names.Num());
+        return static_cast<uint64>(Names.Add(Name)) + 1;
+    };
+
+    for (const FName& Tag : TagNames)
+    {
+        NameRef(Tag);
+    }
+
+    const uint32 FirstSequence = NextSequence - static_cast<uint32>(NumRecords);
+    for (uint32 Sequence = FirstSequence; Sequence < NextSequence; ++Sequence)
+    {
+        const FNewsRecord& Record = Records[GetSlot(Sequence)];
+        NameRef(Record.Source);
+        StringRef(Record.Subject);
+        StringRef(Record.Headline);
+        StringRef(Record.Body);
+        for (uint32 EntryIndex = Record.FirstMetadata; EntryIndex < Record.FirstMetadata + Record.NumMetadata; ++EntryIndex)
+        {
+            NameRef(Metadata[EntryIndex].Key);
+            StringRef(Metadata[EntryIndex].Value);
+        }
+    }
+
+    uint8 Version = NewsHistoryVersion;
+    Ar << Version;
+
+    WriteVarUInt(Ar, Strings.Num());
+    for (const FNewsText& Text : Strings)
+    {
+        WriteUtf8(Ar, GetText(Text));
+    }
+
+    WriteVarUInt(Ar, Names.Num());
+    for (const FName& Name : Names)
+    {
+        const FString NameString = Name.ToString();
+        const FTCHARToUTF8 Utf8(*NameString, NameString.Len());
+        WriteUtf8(Ar, FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()));
+    }
+
+    // Tags were named first, so the tag table is the first TagNames.Num() names and masks can be written as they are.
+    WriteVarUInt(Ar, TagNames.Num());
+
+    WriteVarUInt(Ar, NumRecords);
+    int64 PreviousSeconds = 0;
+    for (uint32 Sequence = FirstSequence; Sequence < NextSequence; ++Sequence)
+    {
+        const FNewsRecord& Record = Records[GetSlot(Sequence)];
+
+        const int64 Seconds = Record.TimestampTicks / ETimespan::TicksPerSecond;
+        WriteVarInt(Ar, Seconds - PreviousSeconds);
+        PreviousSeconds = Seconds;
+
+        uint8 NewsType = static_cast<uint8>(Record.NewsType);
+        uint8 TextTemplate = static_cast<uint8>(Record.TextTemplate);
+        uint8 Flags = Record.bRolledUp ? NewsRecordFlagRolledUp : 0;
+        Ar << NewsType;
+        Ar << TextTemplate;
+        Ar << Flags;
+        if (Record.TextTemplate != ENewsTextTemplate::None)
+        {
+            float TextAmount = Record.TextAmount;
+            Ar << TextAmount;
+        }
+
+        WriteVarUInt(Ar, NameRef(Record.Source));
+        WriteVarUInt(Ar, StringRef(Record.Subject));
+        WriteVarUInt(Ar, StringRef(Record.Headline));
+        WriteVarUInt(Ar, StringRef(Record.Body));
+        WriteVarUInt(Ar, Record.TagMask);
+        WriteVarInt(Ar, Record.ReputationDelta);
+        WriteVarInt(Ar, Record.RevenueDelta);
+
+        WriteVarUInt(Ar, Record.NumMetadata);
+        for (uint32 EntryIndex = Record.FirstMetadata; EntryIndex < Record.FirstMetadata + Record.NumMetadata; ++EntryIndex)
+        {
+            WriteVarUInt(Ar, NameRef(Metadata[EntryIndex].Key));
+            WriteVarUInt(Ar, StringRef(Metadata[EntryIndex].Value));
+        }
+    }
+}
+
+bool FNewsStore::LoadHistory(TConstArrayView<uint8> Bytes)
+{
+    check(IsInGameThread());
+
+    Reset();
+    if (Bytes.IsEmpty())
+    {
+        return true;
+    }
+
+    FMemoryReaderView Ar(Bytes);
+
+    uint8 Version = 0;
+    Ar << Version;
+    if (Version < OldestReadableNewsHistoryVersion || Version > NewsHistoryVersion)
+    {
+        UE_LOG(LogEventSubsystem, Warning, TEXT("Saved news history has version %d, expected %d to %d; starting with an empty history."),
+            Version, OldestReadableNewsHistoryVersion, NewsHistoryVersion);
+        return false;
+    }
+
+    TArray<UTF8CHAR> Utf8;
+
+    // Strings go straight into the arena; index zero stands for the empty string.
+    TArray<FNewsText> Strings;
+    Strings.AddDefaulted();
+    const uint64 NumStrings = ReadVarUInt(Ar);
+    for (uint64 StringIndex = 0; StringIndex < NumStrings && !Ar.IsError(); ++StringIndex)
+    {
+        ReadUtf8(Ar, Utf8);
+        Strings.Add(InternText(FUtf8StringView(Utf8.GetData(), Utf8.Num())));
+    }
+
+    TArray<FName> Names;
+    Names.Add(NAME_None);
+    const uint64 NumNames = ReadVarUInt(Ar);
+    for (uint64 NameIndex = 0; NameIndex < NumNames && !Ar.IsError(); ++NameIndex)
+    {
+        ReadUtf8(Ar, Utf8);
+        Names.Add(FName(FString(FUtf8StringView(Utf8.GetData(), Utf8.Num()))));
+    }
+
+    const uint64 NumTags = ReadVarUInt(Ar);
+    if (NumTags > static_cast<uint64>(FMath::Min(MaxTags, Names.Num() - 1)))
+    {
+        Ar.SetError();
+    }
+    for (uint64 TagIndex = 0; TagIndex < NumTags && !Ar.IsError(); ++TagIndex)
+    {
+        TagIndices.Add(Names[TagIndex + 1], TagNames.Add(Names[TagIndex + 1]));
+    }
+
+    const auto ReadRef = [&Ar](int32 TableSize) -> int32
+    {
+        const uint64 Ref = ReadVarUInt(Ar);
+        if (Ref >= static_cast<uint64>(TableSize))
+        {
+            Ar.SetError();
+            return 0;
+        }
+        return static_cast<int32>(Ref);
+    };
+
+    // Only the newest Capacity items fit; older ones are read past without being kept.
+    const uint64 NumSaved = ReadVarUInt(Ar);
+    const uint64 FirstKept = NumSaved > static_cast<uint64>(Capacity) ? NumSaved - Capacity : 0;
+    int64 Seconds = 0;
+    for (uint64 SavedIndex = 0; SavedIndex < NumSaved && !Ar.IsError(); ++SavedIndex)
+    {
+        FNewsRecord Record;
+
+        Seconds += ReadVarInt(Ar);
+        Record.TimestampTicks = Seconds * ETimespan::TicksPerSecond;
+
+        uint8 NewsType = 0;
+        uint8 TextTemplate = 0;
+        uint8 Flags = 0;
+        Ar << NewsType;
+        Ar << TextTemplate;
+        if (Version >= 2)
+        {
+            Ar << Flags;
+        }
+        Record.NewsType = static_cast<EMusicNewsType>(NewsType);
+        Record.TextTemplate = static_cast<ENewsTextTemplate>(TextTemplate);
+        Record.bRolledUp = (Flags & NewsRecordFlagRolledUp) != 0;
+        if (Record.TextTemplate != ENewsTextTemplate::None)
+        {
+            Ar << Record.TextAmount;
+        }
+
+        Record.Source = Names[ReadRef(Names.Num())];
+        Record.Subject = Strings[ReadRef(Strings.Num())];
+        Record.Headline = Strings[ReadRef(Strings.Num())];
+        Record.Body = Strings[ReadRef(Strings.Num())];
+        Record.TagMask = ReadVarUInt(Ar) & (NumTags >= 64 ? MAX_uint64 : (uint64(1) << NumTags) - 1);
+        Record.ReputationDelta = static_cast<int32>(ReadVarInt(Ar));
+        Record.RevenueDelta = static_cast<int32>(ReadVarInt(Ar));
+
+        const bool bKeep = SavedIndex >= FirstKept;
+        const uint64 NumEntries = ReadVarUInt(Ar);
+        Record.FirstMetadata = static_cast<uint32>(Metadata.Num());
+        for (uint64 EntryIndex = 0; EntryIndex < NumEntries && !Ar.IsError(); ++EntryIndex)
+        {
+            const FName Key = Names[ReadRef(Names.Num())];
+            const FNewsText Value = Strings[ReadRef(Strings.Num())];
+            if (bKeep && Record.NumMetadata < MAX_uint16)
+            {
+                Metadata.Add({ Key, Value });
+                ++Record.NumMetadata;
+            }
+        }
+
+        if (bKeep && !Ar.IsError())
+        {
+            AddRecord(Record);
+        }
+    }
+
+    if (Ar.IsError())
+    {
+        UE_LOG(LogEventSubsystem, Warning, TEXT("Saved news history is damaged; starting with an empty history."));
+        Reset();
+        return false;
+    }
+
+    // Strings only used by items that did not fit are still in the arena; drop them now rather than on eviction.
+    if (FirstKept > 0)
+    {
+        Compact();
+    }
+    return true;
+}
+
+SIZE_T FNewsStore::GetAllocatedSize() const
+{
+    return Records.GetAllocatedSize() + Metadata.GetAllocatedSize() + TextArena.GetAllocatedSize()
+        + TextByHash.GetAllocatedSize() + TagNames.GetAllocatedSize() + TagIndices.GetAllocatedSize()
+        + Index.GetAllocatedSize() + QueryMatches.GetAllocatedSize() + QueryTerm.GetAllocatedSize();
+}
+
+void FNewsStore::Reset()
+{
+    Records.Reset();
+    NumRecords = 0;
+    NumEvictedSinceCompact = 0;
+    NextSequence = 1;
+    Metadata.Reset();
+    TextArena.Reset();
+    TextByHash.Reset();
+    TagNames.Reset();
+    TagIndices.Reset();
+    bWarnedTagOverflow = false;
+    Index.Init(Capacity);
+}
+
+uint32 FNewsStore::GetSequence(int32 Slot) const
+{
+    const uint32 Newest = NextSequence - 1;
+    const int32 NewestSlot = GetSlot(Newest);
+    return Newest - static_cast<uint32>((NewestSlot - Slot + Capacity) % Capacity);
+}
+
+FNewsText FNewsStore::InternText(const FString& Text)
+{
+    FNewsText Result;
+    if (Text.IsEmpty())
+    {
+        return Result;
+    }
+
+    const FTCHARToUTF8 Utf8(*Text, Text.Len());
+    return InternText(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()));
+}
+
+FNewsText FNewsStore::InternText(FUtf8StringView Text)
+{
+    FNewsText Result;
+    if (Text.IsEmpty())
+    {
+        return Result;
+    }
+
+    const uint32 Hash = FCrc::MemCrc32(Text.GetData(), Text.Len() * sizeof(UTF8CHAR));
+    for (auto It = TextByHash.CreateConstKeyIterator(Hash); It; ++It)
+    {
+        if (GetText(It.Value()).Equals(Text, ESearchCase::CaseSensitive))
+        {
+            return It.Value();
+        }
+    }
+
+    Result.Offset = static_cast<uint32>(TextArena.Num());
+    Result.Length = static_cast<uint32>(Text.Len());
+    TextArena.Append(Text.GetData(), Text.Len());
+    TextByHash.Add(Hash, Result);
+    return Result;
+}
+
+void FNewsStore::Compact()
+{
+    const TArray<UTF8CHAR> OldArena = MoveTemp(TextArena);
+    const TArray<FMetadataEntry> OldMetadata = MoveTemp(Metadata);
+    TextByHash.Reset();
+
+    const auto Reintern = [this, &OldArena](FNewsText& Text)
+    {
+        Text = InternText(FUtf8StringView(OldArena.GetData() + Text.Offset, Text.Length));
+    };
+
+    for (uint32 Sequence = NextSequence - static_cast<uint32>(NumRecords); Sequence < NextSequence; ++Sequence)
+    {
+        FNewsRecord& Record = Records[GetSlot(Sequence)];
+        Reintern(Record.Subject);
+        Reintern(Record.Headline);
+        Reintern(Record.Body);
+
+        const uint32 FirstMetadata = static_cast<uint32>(Metadata.Num());
+        for (uint32 EntryIndex = Record.FirstMetadata; EntryIndex < Record.FirstMetadata + Record.NumMetadata; ++EntryIndex)
+        {
+            FMetadataEntry Entry = OldMetadata[EntryIndex];
+            Reintern(Entry.Value);
+            Metadata.Add(Entry);
+        }
+        Record.FirstMetadata = FirstMetadata;
+    }
+
+    NumEvictedSinceCompact = 0;
+}
+
+uint64 FNewsStore::InternTags(const TArray<FString>& Tags)
+{
+    uint64 Mask = 0;
+    for (const FString& Tag : Tags)
+    {
+        if (Tag.IsEmpty())
+        {
+            continue;
+        }
+
+        const FName TagName(*Tag);
+        int32 TagIndex = INDEX_NONE;
+        if (const int32* Found = TagIndices.Find(TagName))
+        {
+            TagIndex = *Found;
+        }
+        else if (TagNames.Num() < MaxTags)
+        {
+            TagIndex = TagNames.Add(TagName);
+            TagIndices.Add(TagName, TagIndex);
+        }
+        else
+        {
+            if (!bWarnedTagOverflow)
+            {
+                UE_LOG(LogEventSubsystem, Warning, TEXT("News store is out of tag bits; dropping tag '%s' and any other new tags."), *Tag);
+                bWarnedTagOverflow = true;
+            }
+            continue;
+        }
+
+        Mask |= uint64(1) << TagIndex;
+    }
+    return Mask;
+}
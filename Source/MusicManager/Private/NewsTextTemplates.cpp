@@ -0,0 +1,198 @@
+#include "NewsTextTemplates.h"
+
+#include "NewsStore.h"
+
+#define LOCTEXT_NAMESPACE "MusicNews"
+
+namespace
+{
+    struct FTemplateFormats
+    {
+        FTextFormat Headline;
+        FTextFormat Body;
+    };
+
+    /** Compiled formats, one per template, in ENewsTextTemplate order. */
+    const FTemplateFormats& GetTemplateFormats(ENewsTextTemplate Template)
+    {
+        static const FTemplateFormats Formats[] =
+        {
+            // None
+            { FTextFormat(), FTextFormat() },
+            // MarketRecap
+            {
+                LOCTEXT("MarketRecapHeadline", "{Month} Market Recap Released"),
+                LOCTEXT("MarketRecapBody", "The arrival of {Month} triggered an automatic news feed refresh."),
+            },
+            // ChartNumberOne
+            {
+                LOCTEXT("ChartNumberOneHeadline", "\"{Subject}\" hits #1"),
+                LOCTEXT("ChartNumberOneBody", "Your single is the most popular song in the country with a popularity of {Amount}."),
+            },
+            // ChartEntry
+            {
+                LOCTEXT("ChartEntryHeadline", "\"{Subject}\" enters the charts"),
+                LOCTEXT("ChartEntryBody", "The single charted for the first time with a popularity of {Amount}."),
+            },
+            // ArtistSigned
+            {
+                LOCTEXT("ArtistSignedHeadline", "{Subject} signs with your label"),
+                LOCTEXT("ArtistSignedBody", "The deal carries a sign-up bonus of ${Amount}."),
+            },
+            // ContractExpired
+            {
+                LOCTEXT("ContractExpiredHeadline", "{Subject}'s contract has ended"),
+                LOCTEXT("ContractExpiredBody", "{Subject} is no longer on your roster."),
+            },
+            // RecordDelivered
+            {
+                LOCTEXT("RecordDeliveredHeadline", "{Subject} delivers {Amount} new {Amount}|plural(one=record,other=records)"),
+                LOCTEXT("RecordDeliveredBody", "The masters are in and ready for release."),
+            },
+            // RevenueMilestone
+            {
+                LOCTEXT("RevenueMilestoneHeadline", "{Subject} passes ${Amount} in lifetime revenue"),
+                LOCTEXT("RevenueMilestoneBody", "The act is one of the label's steadiest earners."),
+            },
+            // RivalTopSingle
+            {
+                LOCTEXT("RivalTopSingleHeadline", "{Artist}'s \"{Subject}\" tops the rival charts"),
+                LOCTEXT("RivalTopSingleBody", "{Source} has the hottest single outside your label this month."),
+            },
+            // RivalSigningSpree
+            {
+                LOCTEXT("RivalSigningSpreeHeadline", "{Source} signs {Amount} new acts"),
+                LOCTEXT("RivalSigningSpreeBody", "{Source} is on a signing spree as it competes for fresh talent."),
+            },
+            // Roundup; types with their own wording use GetRoundupHeadline instead
+            {
+                LOCTEXT("RoundupHeadline", "{Amount} news {Amount}|plural(one=story,other=stories)"),
+                LOCTEXT("RoundupBody", "Including {Subjects}."),
+            },
+        };
+        static_assert(UE_ARRAY_COUNT(Formats) == static_cast<int32>(ENewsTextTemplate::Roundup) + 1,
+            "Add a format for every news text template.");
+
+        const int32 Index = static_cast<int32>(Template);
+        return Formats[Index < static_cast<int32>(UE_ARRAY_COUNT(Formats)) ? Index : 0];
+    }
+
+    /** Roundup headline for the news type, or null to use the generic one. */
+    const FTextFormat* GetRoundupHeadline(EMusicNewsType NewsType)
+    {
+        static const FTextFormat ArtistsSigned(LOCTEXT("RoundupArtistSigned", "{Amount} {Amount}|plural(one=artist,other=artists) signed"));
+        static const FTextFormat ArtistsDropped(LOCTEXT("RoundupArtistDropped", "{Amount} {Amount}|plural(one=artist,other=artists) left the label"));
+        static const FTextFormat ChartAchievements(LOCTEXT("RoundupChartAchievement", "{Amount} chart {Amount}|plural(one=milestone,other=milestones)"));
+        static const FTextFormat RecordReleases(LOCTEXT("RoundupRecordRelease", "{Amount} {Amount}|plural(one=record,other=records) delivered"));
+        static const FTextFormat FinancialReports(LOCTEXT("RoundupFinancialReport", "{Amount} revenue {Amount}|plural(one=milestone,other=milestones)"));
+        static const FTextFormat RivalNews(LOCTEXT("RoundupRivalLabelNews", "{Amount} rival label {Amount}|plural(one=story,other=stories)"));
+
+        switch (NewsType)
+        {
+        case EMusicNewsType::ArtistSigned:      return &ArtistsSigned;
+        case EMusicNewsType::ArtistDropped:     return &ArtistsDropped;
+        case EMusicNewsType::ChartAchievement:  return &ChartAchievements;
+        case EMusicNewsType::RecordRelease:     return &RecordReleases;
+        case EMusicNewsType::FinancialReport:   return &FinancialReports;
+        case EMusicNewsType::RivalLabelNews:    return &RivalNews;
+        default:                                return nullptr;
+        }
+    }
+
+    FText FormatTemplate(const FTextFormat& Format, const FNewsRecord& Record, const FNewsStore& Store)
+    {
+        FFormatNamedArguments Arguments;
+        Arguments.Add(TEXT("Subject"), Record.Subject.Length == 0 ? FText::GetEmpty() : FText::FromString(FString(Store.GetText(Record.Subject))));
+        Arguments.Add(TEXT("Source"), Record.Source.IsNone() ? FText::GetEmpty() : FText::FromName(Record.Source));
+        Arguments.Add(TEXT("Amount"), FMath::RoundToInt(Record.TextAmount));
+        Store.ForEachMetadata(Record, [&Arguments](FName Key, FUtf8StringView Value)
+        {
+            Arguments.Add(Key.ToString(), FText::FromString(FString(Value)));
+        });
+        if (Record.TextTemplate == ENewsTextTemplate::MarketRecap)
+        {
+            Arguments.Add(TEXT("Month"), FNewsTextTemplates::FormatMonthYear(FDateTime(Record.TimestampTicks)));
+        }
+        return FText::Format(Format, Arguments);
+    }
+
+    FText AsYear(int32 Year)
+    {
+        return FText::AsNumber(Year, &FNumberFormattingOptions::DefaultNoGrouping());
+    }
+}
+
+FText FNewsTextTemplates::FormatHeadline(const FNewsRecord& Record, const FNewsStore& Store)
+{
+    if (Record.TextTemplate == ENewsTextTemplate::None)
+    {
+        return Record.Headline.Length == 0 ? FText::GetEmpty() : FText::FromString(FString(Store.GetText(Record.Headline)));
+    }
+    if (Record.TextTemplate == ENewsTextTemplate::Roundup)
+    {
+        if (const FTextFormat* RoundupHeadline = GetRoundupHeadline(Record.NewsType))
+        {
+            return FormatTemplate(*RoundupHeadline, Record, Store);
+        }
+    }
+    return FormatTemplate(GetTemplateFormats(Record.TextTemplate).Headline, Record, Store);
+}
+
+FText FNewsTextTemplates::FormatBody(const FNewsRecord& Record, const FNewsStore& Store)
+{
+    if (Record.TextTemplate == ENewsTextTemplate::None)
+    {
+        return Record.Body.Length == 0 ? FText::GetEmpty() : FText::FromString(FString(Store.GetText(Record.Body)));
+    }
+    return FormatTemplate(GetTemplateFormats(Record.TextTemplate).Body, Record, Store);
+}
+
+const FText& FNewsTextTemplates::GetMonthName(int32 Month)
+{
+    static const FText MonthNames[] =
+    {
+        LOCTEXT("January", "January"), LOCTEXT("February", "February"), LOCTEXT("March", "March"),
+        LOCTEXT("April", "April"), LOCTEXT("May", "May"), LOCTEXT("June", "June"),
+        LOCTEXT("July", "July"), LOCTEXT("August", "August"), LOCTEXT("September", "September"),
+        LOCTEXT("October", "October"), LOCTEXT("November", "November"), LOCTEXT("December", "December"),
+    };
+    return MonthNames[FMath::Clamp(Month, 1, 12) - 1];
+}
+
+const FText& FNewsTextTemplates::GetShortMonthName(int32 Month)
+{
+    static const FText ShortMonthNames[] =
+    {
+        LOCTEXT("JanuaryShort", "Jan"), LOCTEXT("FebruaryShort", "Feb"), LOCTEXT("MarchShort", "Mar"),
+        LOCTEXT("AprilShort", "Apr"), LOCTEXT("MayShort", "May"), LOCTEXT("JuneShort", "Jun"),
+        LOCTEXT("JulyShort", "Jul"), LOCTEXT("AugustShort", "Aug"), LOCTEXT("SeptemberShort", "Sep"),
+        LOCTEXT("OctoberShort", "Oct"), LOCTEXT("NovemberShort", "Nov"), LOCTEXT("DecemberShort", "Dec"),
+    };
+    return ShortMonthNames[FMath::Clamp(Month, 1, 12) - 1];
+}
+
+FText FNewsTextTemplates::FormatMonthYear(const FDateTime& Date)
+{
+    static const FTextFormat MonthYearFormat(LOCTEXT("MonthYear", "{Month} {Year}"));
+
+    FFormatNamedArguments Arguments;
+    Arguments.Add(TEXT("Month"), GetMonthName(Date.GetMonth()));
+    Arguments.Add(TEXT("Year"), AsYear(Date.GetYear()));
+    return FText::Format(MonthYearFormat, Arguments);
+}
+
+FText FNewsTextTemplates::FormatCardDate(const FDateTime& Date)
+{
+    static const FTextFormat CardDateFormat(LOCTEXT("CardDate", "{Month} {Day}, {Year}"));
+
+    FNumberFormattingOptions DayOptions;
+    DayOptions.MinimumIntegralDigits = 2;
+
+    FFormatNamedArguments Arguments;
+    Arguments.Add(TEXT("Month"), GetShortMonthName(Date.GetMonth()));
+    Arguments.Add(TEXT("Day"), FText::AsNumber(Date.GetDay(), &DayOptions));
+    Arguments.Add(TEXT("Year"), AsYear(Date.GetYear()));
+    return FText::Format(CardDateFormat, Arguments);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,81 @@
+#include "NewsTickerScheduler.h"
+
+int32 FNewsTickerScheduler::GetTypePriority(EMusicNewsType NewsType)
+{
+    switch (NewsType)
+    {
+    case EMusicNewsType::ChartAchievement:
+    case EMusicNewsType::ArtistAward:
+        return 9;
+    case EMusicNewsType::ArtistSigned:
+    case EMusicNewsType::ArtistScandal:
+    case EMusicNewsType::DealSigned:
+        return 8;
+    case EMusicNewsType::FinancialReport:
+    case EMusicNewsType::ArtistDropped:
+    case EMusicNewsType::RivalLabelNews:
+        return 6;
+    case EMusicNewsType::RecordRelease:
+    case EMusicNewsType::MusicVideoRelease:
+    case EMusicNewsType::Partnership:
+    case EMusicNewsType::LabelExpansion:
+        return 5;
+    case EMusicNewsType::MarketShift:
+    case EMusicNewsType::FestivalAnnouncement:
+        return 4;
+    default:
+        return 2;
+    }
+}
+
+void FNewsTickerScheduler::Add(FNewsHandle News, EMusicNewsType NewsType)
+{
+    FGroup* Group = Groups.FindByPredicate([NewsType](const FGroup& Candidate) { return Candidate.NewsType == NewsType; });
+    if (!Group)
+    {
+        Group = &Groups.AddDefaulted_GetRef();
+        Group->NewsType = NewsType;
+        Group->Priority = GetTypePriority(NewsType);
+    }
+    Group->News.Add(News);
+}
+
+bool FNewsTickerScheduler::Pop(FNewsTickerRelease& OutRelease)
+{
+    int32 BestIndex = INDEX_NONE;
+    for (int32 Index = 0; Index < Groups.Num(); ++Index)
+    {
+        const FGroup& Group = Groups[Index];
+        if (BestIndex == INDEX_NONE
+            || Group.Priority > Groups[BestIndex].Priority
+            || (Group.Priority == Groups[BestIndex].Priority && Group.News[0].Sequence < Groups[BestIndex].News[0].Sequence))
+        {
+            BestIndex = Index;
+        }
+    }
+
+    if (BestIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FGroup& Best = Groups[BestIndex];
+    OutRelease.NewsType = Best.NewsType;
+    OutRelease.News.Reset();
+    if (Best.News.Num() >= FMath::Max(CollapseThreshold, 2))
+    {
+        OutRelease.News = MoveTemp(Best.News);
+        Best.News.Reset();
+    }
+    else
+    {
+        OutRelease.News.Add(Best.News[0]);
+        Best.News.RemoveAt(0, EAllowShrinking::No);
+    }
+
+    if (Best.News.IsEmpty())
+    {
+        Groups.RemoveAtSwap(BestIndex, EAllowShrinking::No);
+    }
+    return true;
+}
@@ -0,0 +1,465 @@
+#include "RivalLabelSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/GameInstance.h"
+#include "EventSubsystem.h"
+#include "GameTimeSubsystem.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformTime.h"
+#include "MusicManagerStats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Song.h"
+#include "SongManagerSubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogRivalLabels);
+
+DECLARE_CYCLE_STAT(TEXT("Rival Labels StepMonth"), STAT_RivalStepMonth, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Rival Labels PublishMonth"), STAT_RivalPublishMonth, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rival Artist Slots"), STAT_RivalSlots, STATGROUP_MusicSimulation);
+
+namespace
+{
+    const TCHAR* const LabelNames[] = {
+        TEXT("Bluebird Sound"), TEXT("Crescent Records"), TEXT("Starlight Music"), TEXT("Harbor Lane Records"),
+        TEXT("Golden Spur"), TEXT("Midnight Owl Records"), TEXT("Silvertone"), TEXT("Red Rooster Records"),
+        TEXT("Northern Lights Music"), TEXT("Velvet Groove"), TEXT("Liberty Bell Records"), TEXT("Jukebox Royale"),
+        TEXT("Magnolia Sound"), TEXT("Atlas Phonograph"), TEXT("Riverbend Records"), TEXT("Neon Palm"),
+        TEXT("Copper Kettle Music"), TEXT("Skyline Records"), TEXT("Thunderbird Sound"), TEXT("Paper Moon Records")
+    };
+
+    const TCHAR* const FirstNames[] = {
+        TEXT("Johnny"), TEXT("Peggy"), TEXT("Buddy"), TEXT("Ruby"), TEXT("Eddie"), TEXT("Dottie"), TEXT("Roy"), TEXT("Connie"),
+        TEXT("Jerry"), TEXT("Wanda"), TEXT("Gene"), TEXT("Brenda"), TEXT("Carl"), TEXT("Patsy"), TEXT("Ricky"), TEXT("Etta")
+    };
+
+    const TCHAR* const LastNames[] = {
+        TEXT("Walker"), TEXT("Monroe"), TEXT("Hollis"), TEXT("Price"), TEXT("Lane"), TEXT("Dawson"), TEXT("Fontaine"), TEXT("Reed"),
+        TEXT("Sparks"), TEXT("Carter"), TEXT("Valentine"), TEXT("Bishop"), TEXT("Shaw"), TEXT("Maddox"), TEXT("Hart"), TEXT("Cole")
+    };
+
+    const TCHAR* const SongAdjectives[] = {
+        TEXT("Blue"), TEXT("Lonely"), TEXT("Electric"), TEXT("Sweet"), TEXT("Midnight"), TEXT("Golden"), TEXT("Crazy"), TEXT("Silver"),
+        TEXT("Wild"), TEXT("Velvet"), TEXT("Broken"), TEXT("Rocking"), TEXT("Summer"), TEXT("Restless"), TEXT("Little"), TEXT("Burning")
+    };
+
+    const TCHAR* const SongNouns[] = {
+        TEXT("Heart"), TEXT("Train"), TEXT("Moon"), TEXT("Highway"), TEXT("Kiss"), TEXT("Jukebox"), TEXT("River"), TEXT("Baby"),
+        TEXT("Rain"), TEXT("Shoes"), TEXT("Dream"), TEXT("Town"), TEXT("Fire"), TEXT("Letter"), TEXT("Angel"), TEXT("Boogie")
+    };
+
+    constexpr int32 NumLabelNames = UE_ARRAY_COUNT(LabelNames);
+
+    /** Chance per month that a label fills a free artist slot. */
+    constexpr float SigningChance = 0.08f;
+
+    /** Popularity below which a rival single leaves the chart, matching the player's archive threshold. */
+    constexpr float ChartDropPopularity = 5.f;
+
+    /** Signings in one month that make a label's spree newsworthy. */
+    constexpr int32 NewsworthySigningCount = 4;
+
+    template <int32 N>
+    const TCHAR* PickFrom(const TCHAR* const (&Table)[N], uint32 Seed)
+    {
+        return Table[Seed % N];
+    }
+
+    FContractSimState MakeRandomRivalContract(FRandomStream& Stream)
+    {
+        FArtistData Artist;
+        Artist.PerformanceScore = Stream.FRandRange(20.f, 90.f);
+        Artist.StagePresence = Stream.FRandRange(20.f, 90.f);
+        Artist.AudienceEngagement = Stream.FRandRange(20.f, 90.f);
+        Artist.VocalQuality = Stream.FRandRange(20.f, 90.f);
+        Artist.SongwritingQuality = Stream.FRandRange(20.f, 90.f);
+
+        FArtistDealTerms Deal;
+        Deal.ContractYears = Stream.RandRange(1, 5);
+        Deal.NumRecords = Stream.RandRange(1, 6);
+        Deal.RoyaltyRate = Stream.FRandRange(8.f, 20.f);
+
+        return MusicSimulation::MakeContractState(Deal, Artist);
+    }
+}
+
+void URivalLabelSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    SeedLabels();
+
+    if (UGameTimeSubsystem* TimeSubsystem = Collection.InitializeDependency<UGameTimeSubsystem>())
+    {
+        StepStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::Market, TEXT("RivalLabels"),
+            FMonthStageDelegate::CreateUObject(this, &URivalLabelSubsystem::StepMonth), EMonthStageThread::Worker);
+        PublishStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::News, TEXT("RivalNews"),
+            FMonthStageDelegate::CreateUObject(this, &URivalLabelSubsystem::PublishMonth));
+    }
+}
+
+void URivalLabelSubsystem::Deinitialize()
+{
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+        {
+            TimeSubsystem->UnregisterMonthStage(StepStageHandle);
+            TimeSubsystem->UnregisterMonthStage(PublishStageHandle);
+        }
+    }
+
+    Super::Deinitialize();
+}
+
+void URivalLabelSubsystem::SeedLabels()
+{
+    const int32 NumSlots = NumRivalLabels * ArtistSlotsPerLabel;
+
+    Labels.Reset(NumRivalLabels);
+    LabelMonths.SetNum(NumRivalLabels);
+
+    SlotContracts.SetNum(NumSlots);
+    SlotSingles.SetNum(NumSlots);
+    SlotArtistSeeds.SetNumZeroed(NumSlots);
+    SlotSingleSeeds.SetNumZeroed(NumSlots);
+    SlotContractActive.SetNumZeroed(NumSlots);
+    SlotSingleCharting.SetNumZeroed(NumSlots);
+
+    RivalChart.Reset();
+    PendingChart.Reset();
+    PreviousTopSlot = INDEX_NONE;
+    MonthsSimulated = 0;
+
+    FRandomStream Stream(WorldSeed);
+
+    for (int32 LabelIndex = 0; LabelIndex < NumRivalLabels; ++LabelIndex)
+    {
+        FRivalLabel& Label = Labels.AddDefaulted_GetRef();
+        Label.Name = LabelIndex < NumLabelNames
+            ? FString(LabelNames[LabelIndex])
+            : FString::Printf(TEXT("%s %d"), LabelNames[LabelIndex % NumLabelNames], LabelIndex / NumLabelNames + 1);
+        Label.FirstSlot = LabelIndex * ArtistSlotsPerLabel;
+        Label.NumSlots = ArtistSlotsPerLabel;
+        Label.Cash = 250000.f;
+
+        for (int32 Slot = Label.FirstSlot; Slot < Label.FirstSlot + Label.NumSlots; ++Slot)
+        {
+            SlotArtistSeeds[Slot] = Stream.GetUnsignedInt();
+
+            // Start rosters about two-thirds full and mid-contract so labels have room to sign and expire.
+            if (Stream.FRand() < 0.66f)
+            {
+                FContractSimState& Contract = SlotContracts[Slot];
+                Contract = MakeRandomRivalContract(Stream);
+                Contract.MonthsActive = Stream.RandRange(0, FMath::Max(Contract.ContractMonths - 1, 0));
+                SlotContractActive[Slot] = 1;
+            }
+        }
+    }
+
+    UE_LOG(LogRivalLabels, Display, TEXT("Seeded %d rival labels with %d artist slots."), Labels.Num(), NumSlots);
+}
+
+bool URivalLabelSubsystem::StepMonth(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(URivalLabelSubsystem::StepMonth);
+    SCOPE_CYCLE_COUNTER(STAT_RivalStepMonth);
+    LLM_SCOPE_BYNAME(TEXT("MusicSim/RivalLabels"));
+
+    Cursor = SlotContracts.Num();
+    SET_DWORD_STAT(STAT_RivalSlots, SlotContracts.Num());
+
+    if (Labels.Num() == 0)
+    {
+        return true;
+    }
+
+    const double StartSeconds = FPlatformTime::Seconds();
+
+    ++MonthsSimulated;
+    const int32 MonthSeed = static_cast<int32>(HashCombine(GetTypeHash(WorldSeed), GetTypeHash(NewMonth)));
+
+    // Labels only touch their own slot range and month record, so they step independently.
+    ParallelFor(Labels.Num(), [this, MonthSeed](int32 LabelIndex)
+    {
+        SimulateLabelMonth(LabelIndex, MonthSeed);
+    });
+
+    for (int32 LabelIndex = 0; LabelIndex < Labels.Num(); ++LabelIndex)
+    {
+        Labels[LabelIndex].Cash += LabelMonths[LabelIndex].Revenue - LabelMonths[LabelIndex].Cost;
+    }
+
+    RebuildChart();
+
+    PendingMonthStepMilliseconds = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+    if (PendingMonthStepMilliseconds > MonthBudgetMilliseconds)
+    {
+        UE_LOG(LogRivalLabels, Warning, TEXT("Rival month step took %.2f ms (budget %.2f ms) for %d artist slots."),
+            PendingMonthStepMilliseconds, MonthBudgetMilliseconds, SlotContracts.Num());
+    }
+
+    return true;
+}
+
+bool URivalLabelSubsystem::PublishMonth(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    check(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(URivalLabelSubsystem::PublishMonth);
+    SCOPE_CYCLE_COUNTER(STAT_RivalPublishMonth);
+
+    Cursor = PendingChart.Num();
+
+    if (Labels.Num() == 0)
+    {
+        return true;
+    }
+
+    Swap(RivalChart, PendingChart);
+    LastMonthStepMilliseconds = PendingMonthStepMilliseconds;
+
+    PostRivalNews(NewMonth);
+    return true;
+}
+
+void URivalLabelSubsystem::SimulateLabelMonth(int32 LabelIndex, int32 MonthSeed)
+{
+    const FRivalLabel& Label = Labels[LabelIndex];
+    FRivalLabelMonth& Month = LabelMonths[LabelIndex];
+    Month = FRivalLabelMonth();
+
+    FRandomStream Stream(static_cast<int32>(HashCombine(static_cast<uint32>(MonthSeed), GetTypeHash(LabelIndex))));
+
+    // Cash is only updated after every label has stepped, so reading it here does not race with other tasks.
+    float SigningBudget = FMath::Max(Label.Cash, 0.f) * FMath::Clamp(SigningBudgetShare, 0.f, 1.f);
+
+    for (int32 Slot = Label.FirstSlot; Slot < Label.FirstSlot + Label.NumSlots; ++Slot)
+    {
+        if (SlotSingleCharting[Slot])
+        {
+            FSongSimState& Single = SlotSingles[Slot];
+            MusicSimulation::StepSongMonth(Single, Stream.FRandRange(0.f, MusicSimulation::MaxViralRoll));
+            if (Single.CurrentPopularity < ChartDropPopularity && Single.ChartWeeks > 0)
+            {
+                SlotSingleCharting[Slot] = 0;
+            }
+        }
+
+        if (!SlotContractActive[Slot])
+        {
+            // A slot is reused once its previous artist's single has left the chart.
+            if (!SlotSingleCharting[Slot] && SigningBudget > 0.f && Stream.FRand() < SigningChance)
+            {
+                const float SigningBonus = Stream.FRandRange(2000.f, 20000.f);
+                if (SigningBonus > SigningBudget)
+                {
+                    continue;
+                }
+                SigningBudget -= SigningBonus;
+
+                SlotContracts[Slot] = MakeRandomRivalContract(Stream);
+                SlotArtistSeeds[Slot] = Stream.GetUnsignedInt();
+                SlotContractActive[Slot] = 1;
+
+                Month.Cost += SigningBonus;
+                ++Month.Signings;
+            }
+            continue;
+        }
+
+        FContractSimState& Contract = SlotContracts[Slot];
+        const FContractMonthResult Result = MusicSimulation::StepContractMonth(Contract);
+
+        Month.Revenue += Result.GrossRevenue;
+        Month.Cost += Result.RoyaltyPayment + Result.UpkeepCost;
+
+        if (Result.CompletedRecords > 0)
+        {
+            SlotSingles[Slot] = MusicSimulation::MakeRandomSongState(Stream);
+            SlotSingleSeeds[Slot] = Stream.GetUnsignedInt();
+            SlotSingleCharting[Slot] = 1;
+            ++Month.Releases;
+        }
+
+        if (Contract.MonthsActive >= Contract.ContractMonths)
+        {
+            SlotContractActive[Slot] = 0;
+            ++Month.Expirations;
+        }
+    }
+}
+
+void URivalLabelSubsystem::RebuildChart()
+{
+    const auto ByPopularity = [this](int32 A, int32 B)
+    {
+        return SlotSingles[A].CurrentPopularity < SlotSingles[B].CurrentPopularity;
+    };
+
+    // Min-heap of the best ChartSize slots so far; avoids sorting every charting single.
+    TArray<int32, TInlineAllocator<128>> TopSlots;
+    for (int32 Slot = 0; Slot < SlotSingles.Num(); ++Slot)
+    {
+        if (!SlotSingleCharting[Slot])
+        {
+            continue;
+        }
+
+        if (TopSlots.Num() < ChartSize)
+        {
+            TopSlots.HeapPush(Slot, ByPopularity);
+        }
+        else if (SlotSingles[Slot].CurrentPopularity > SlotSingles[TopSlots.HeapTop()].CurrentPopularity)
+        {
+            TopSlots.HeapPopDiscard(ByPopularity, EAllowShrinking::No);
+            TopSlots.HeapPush(Slot, ByPopularity);
+        }
+    }
+
+    TopSlots.Sort([this](int32 A, int32 B)
+    {
+        return SlotSingles[A].CurrentPopularity > SlotSingles[B].CurrentPopularity;
+    });
+
+    PendingChart.Reset(TopSlots.Num());
+    for (const int32 Slot : TopSlots)
+    {
+        FChartEntry& Entry = PendingChart.AddDefaulted_GetRef();
+        Entry.SongName = MakeSongName(Slot);
+        Entry.ArtistName = MakeArtistName(Slot);
+        Entry.LabelName = Labels[Slot / ArtistSlotsPerLabel].Name;
+        Entry.Popularity = SlotSingles[Slot].CurrentPopularity;
+        Entry.ChartWeeks = SlotSingles[Slot].ChartWeeks;
+    }
+
+    const int32 TopSlot = TopSlots.Num() > 0 ? TopSlots[0] : INDEX_NONE;
+    if (TopSlot != PreviousTopSlot)
+    {
+        // Remember the change for PostRivalNews, which runs in the News phase.
+        PreviousTopSlot = TopSlot;
+        bTopSlotChanged = TopSlot != INDEX_NONE;
+    }
+    else
+    {
+        bTopSlotChanged = false;
+    }
+}
+
+void URivalLabelSubsystem::PostRivalNews(const FGameMonth& NewMonth)
+{
+    if (MaxNewsPerMonth <= 0)
+    {
+        return;
+    }
+
+    UGameInstance* GameInstance = GetGameInstance();
+    UEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UEventSubsystem>() : nullptr;
+    if (!IsValid(EventSubsystem))
+    {
+        return;
+    }
+
+    int32 NumPosted = 0;
+
+    const FDateTime Timestamp = NewMonth.ToDateTime();
+    const auto MakeRivalEvent = [&Timestamp](const FString& LabelName)
+    {
+        FMusicNewsEvent Event;
+        Event.NewsId = FGuid::NewGuid();
+        Event.Timestamp = Timestamp;
+        Event.NewsType = EMusicNewsType::RivalLabelNews;
+        Event.SourceName = LabelName;
+        Event.Tags = { TEXT("Rivals") };
+        return Event;
+    };
+
+    if (bTopSlotChanged && RivalChart.Num() > 0 && NumPosted < MaxNewsPerMonth)
+    {
+        const FChartEntry& Top = RivalChart[0];
+
+        FMusicNewsEvent Event = MakeRivalEvent(Top.LabelName);
+        Event.SubjectName = Top.SongName;
+        Event.TextTemplate = ENewsTextTemplate::RivalTopSingle;
+        Event.Metadata.Add(TEXT("Artist"), Top.ArtistName);
+        Event.Tags.Add(TEXT("Charts"));
+
+        EventSubsystem->PostNews(Event);
+        ++NumPosted;
+    }
+
+    int32 BusiestLabel = INDEX_NONE;
+    for (int32 LabelIndex = 0; LabelIndex < LabelMonths.Num(); ++LabelIndex)
+    {
+        if (BusiestLabel == INDEX_NONE || LabelMonths[LabelIndex].Signings > LabelMonths[BusiestLabel].Signings)
+        {
+            BusiestLabel = LabelIndex;
+        }
+    }
+
+    if (BusiestLabel != INDEX_NONE && LabelMonths[BusiestLabel].Signings >= NewsworthySigningCount && NumPosted < MaxNewsPerMonth)
+    {
+        const FRivalLabel& Label = Labels[BusiestLabel];
+
+        FMusicNewsEvent Event = MakeRivalEvent(Label.Name);
+        Event.TextTemplate = ENewsTextTemplate::RivalSigningSpree;
+        Event.TextAmount = static_cast<float>(LabelMonths[BusiestLabel].Signings);
+        Event.Tags.Add(TEXT("Signings"));
+
+        EventSubsystem->PostNews(Event);
+        ++NumPosted;
+    }
+}
+
+TArray<FChartEntry> URivalLabelSubsystem::GetCombinedChart(int32 Count) const
+{
+    ensure(IsInGameThread());
+
+    TArray<FChartEntry> Chart;
+    if (Count <= 0)
+    {
+        return Chart;
+    }
+
+    Chart.Reserve(Count + RivalChart.Num());
+
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        if (USongManagerSubsystem* SongManager = GameInstance->GetSubsystem<USongManagerSubsystem>())
+        {
+            for (const USong* Song : SongManager->GetTopSongs(Count))
+            {
+                FChartEntry& Entry = Chart.AddDefaulted_GetRef();
+                Entry.SongName = Song->Data.SongName;
+                Entry.ArtistName = Song->ArtistId;
+                Entry.Popularity = Song->Data.CurrentPopularity;
+                Entry.ChartWeeks = Song->Data.ChartWeeks;
+                Entry.bPlayerLabel = true;
+            }
+        }
+    }
+
+    Chart.Append(RivalChart);
+    Chart.Sort([](const FChartEntry& A, const FChartEntry& B)
+    {
+        return A.Popularity > B.Popularity;
+    });
+
+    if (Chart.Num() > Count)
+    {
+        Chart.SetNum(Count);
+    }
+
+    return Chart;
+}
+
+FString URivalLabelSubsystem::MakeArtistName(int32 Slot) const
+{
+    const uint32 Seed = SlotArtistSeeds[Slot];
+    return FString::Printf(TEXT("%s %s"), PickFrom(FirstNames, Seed), PickFrom(LastNames, Seed >> 8));
+}
+
+FString URivalLabelSubsystem::MakeSongName(int32 Slot) const
+{
+    const uint32 Seed = SlotSingleSeeds[Slot];
+    return FString::Printf(TEXT("%s %s"), PickFrom(SongAdjectives, Seed), PickFrom(SongNouns, Seed >> 8));
+}
@@ -0,0 +1,137 @@
+#include "SimulationFork.h"
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void FSimulationFork::Run(FSimulationForkState State, const FSimulationWhatIf& WhatIf, FSimulationForkReport& OutReport)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FSimulationFork::Run);
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    // The UPROPERTY clamp only applies in the editor; a forecast must not be able to pin a worker indefinitely.
+    const int32 NumMonths = FMath::Clamp(WhatIf.MonthsToSimulate, 1, FSimulationWhatIf::MaxMonthsToSimulate);
+
+    OutReport.StartMonth = State.Month;
+    OutReport.MonthsSimulated = NumMonths;
+    OutReport.MonthlyProfit.SetNumZeroed(NumMonths);
+
+    // A contract signed in a month is first stepped the month after, as in the live game.
+    for (const FWhatIfSigning& Signing : WhatIf.Signings)
+    {
+        const FGameMonth SignMonth = State.Month + FMath::Max(Signing.DelayMonths, 0);
+        const int32 ContractMonths = MusicSimulation::GetContractDurationMonths(Signing.Deal);
+        const FGameMonth StartMonth = Signing.Deal.ProposedStartMonth.IsValid() ? Signing.Deal.ProposedStartMonth : SignMonth;
+
+        FSimulationForkState::FContract Contract;
+        Contract.State = MusicSimulation::MakeContractState(Signing.Deal, Signing.Artist);
+        Contract.ActiveFrom = SignMonth + 1;
+        Contract.ExpiryMonth = FMath::Min(StartMonth + ContractMonths, SignMonth + ContractMonths);
+        State.Contracts.Add(Contract);
+
+        const int32 SignMonthIndex = Contract.ActiveFrom - (State.Month + 1);
+        if (SignMonthIndex < NumMonths)
+        {
+            OutReport.MonthlyProfit[SignMonthIndex] -= Signing.Deal.SignUpBonus;
+            OutReport.TotalCost += Signing.Deal.SignUpBonus;
+        }
+    }
+
+    // Releases hold an active song back until its new release month.
+    TArray<int32, TInlineAllocator<4>> ReleaseSongIndices;
+    for (const FWhatIfRelease& Release : WhatIf.Releases)
+    {
+        FWhatIfSongOutcome& Outcome = OutReport.Songs.AddDefaulted_GetRef();
+        Outcome.SongId = Release.SongId;
+
+        const int32 SongIndex = State.SongIds->IndexOfByKey(Release.SongId);
+        ReleaseSongIndices.Add(SongIndex);
+        if (SongIndex != INDEX_NONE)
+        {
+            Outcome.bFound = true;
+            State.Songs.GetMutable(SongIndex).ActiveFrom = State.Month + FMath::Max(Release.DelayMonths, 0) + 1;
+        }
+    }
+
+    for (int32 MonthOffset = 0; MonthOffset < NumMonths; ++MonthOffset)
+    {
+        const FGameMonth Month = State.Month + MonthOffset + 1;
+
+        // Same stream and draw order as USongManagerSubsystem::StepMonth.
+        FRandomStream Stream = MusicSimulation::MakeViralRollStream(State.CampaignSeed, Month);
+        for (int32 ChunkIndex = 0; ChunkIndex < State.Songs.NumChunks(); ++ChunkIndex)
+        {
+            for (FSimulationForkState::FSong& Song : State.Songs.GetMutableChunk(ChunkIndex))
+            {
+                if (Song.bFaded || Month < Song.ActiveFrom)
+                {
+                    continue;
+                }
+
+                MusicSimulation::StepSongMonth(Song.State, Stream.FRandRange(0.f, MusicSimulation::MaxViralRoll));
+                Song.bFaded = Song.State.CurrentPopularity < MusicSimulation::ArchivePopularity;
+            }
+        }
+
+        float& MonthProfit = OutReport.MonthlyProfit[MonthOffset];
+        for (int32 ChunkIndex = 0; ChunkIndex < State.Contracts.NumChunks(); ++ChunkIndex)
+        {
+            for (FSimulationForkState::FContract& Contract : State.Contracts.GetMutableChunk(ChunkIndex))
+            {
+                if (Month < Contract.ActiveFrom || Month > Contract.ExpiryMonth)
+                {
+                    continue;
+                }
+
+                const FContractMonthResult Result = MusicSimulation::StepContractMonth(Contract.State);
+                const float MonthCost = Result.RoyaltyPayment + Result.UpkeepCost;
+
+                MonthProfit += Result.GrossRevenue - MonthCost;
+                OutReport.TotalRevenue += Result.GrossRevenue;
+                OutReport.TotalCost += MonthCost;
+                OutReport.RecordsDelivered += Result.CompletedRecords;
+
+                if (Month == Contract.ExpiryMonth)
+                {
+                    ++OutReport.ContractsExpired;
+                }
+            }
+        }
+
+        for (int32 ReleaseIndex = 0; ReleaseIndex < ReleaseSongIndices.Num(); ++ReleaseIndex)
+        {
+            if (ReleaseSongIndices[ReleaseIndex] != INDEX_NONE)
+            {
+                FWhatIfSongOutcome& Outcome = OutReport.Songs[ReleaseIndex];
+                const FSimulationForkState::FSong& Song = State.Songs[ReleaseSongIndices[ReleaseIndex]];
+                Outcome.PeakPopularity = FMath::Max(Outcome.PeakPopularity, Song.State.CurrentPopularity);
+            }
+        }
+    }
+
+    for (int32 ReleaseIndex = 0; ReleaseIndex < ReleaseSongIndices.Num(); ++ReleaseIndex)
+    {
+        if (ReleaseSongIndices[ReleaseIndex] != INDEX_NONE)
+        {
+            FWhatIfSongOutcome& Outcome = OutReport.Songs[ReleaseIndex];
+            const FSimulationForkState::FSong& Song = State.Songs[ReleaseSongIndices[ReleaseIndex]];
+            Outcome.FinalPopularity = Song.State.CurrentPopularity;
+            Outcome.ChartWeeks = Song.State.ChartWeeks;
+            Outcome.bFaded = Song.bFaded;
+        }
+    }
+
+    for (int32 ChunkIndex = 0; ChunkIndex < State.Songs.NumChunks(); ++ChunkIndex)
+    {
+        for (const FSimulationForkState::FSong& Song : State.Songs.GetChunk(ChunkIndex))
+        {
+            if (!Song.bFaded && Song.State.CurrentPopularity > MusicSimulation::ChartingPopularity)
+            {
+                ++OutReport.ChartingSongs;
+            }
+        }
+    }
+
+    OutReport.NetProfit = OutReport.TotalRevenue - OutReport.TotalCost;
+    OutReport.ElapsedMilliseconds = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
@@ -0,0 +1,149 @@
+#include "SimulationPreviewSubsystem.h"
+
+#include "ArtistManagerSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "GameThreadCommandQueue.h"
+#include "GameTimeSubsystem.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Song.h"
+#include "SongManagerSubsystem.h"
+#include "Tasks/Task.h"
+
+DEFINE_LOG_CATEGORY(LogSimulationPreview);
+
+void USimulationPreviewSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Collection.InitializeDependency<UGameTimeSubsystem>();
+    Collection.InitializeDependency<USongManagerSubsystem>();
+    Collection.InitializeDependency<UArtistManagerSubsystem>();
+}
+
+void USimulationPreviewSubsystem::Deinitialize()
+{
+    ForkPoint = FSimulationForkState();
+    ForkPointChart.Reset();
+
+    Super::Deinitialize();
+}
+
+int32 USimulationPreviewSubsystem::PreviewWhatIf(const FSimulationWhatIf& WhatIf, const FOnWhatIfPreviewed& OnComplete)
+{
+    check(IsInGameThread());
+
+    const int32 RequestId = ++LastRequestId;
+    const TWeakObjectPtr<USimulationPreviewSubsystem> WeakThis(this);
+    const float BudgetMilliseconds = PreviewBudgetMilliseconds;
+
+    UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [State = ForkLiveState(), WhatIf, RequestId, BudgetMilliseconds, WeakThis, OnComplete]() mutable
+        {
+            LLM_SCOPE_BYNAME(TEXT("MusicSim/Previews"));
+
+            FSimulationForkReport Report;
+            Report.RequestId = RequestId;
+            FSimulationFork::Run(MoveTemp(State), WhatIf, Report);
+
+            if (Report.ElapsedMilliseconds > BudgetMilliseconds)
+            {
+                UE_LOG(LogSimulationPreview, Warning, TEXT("Preview %d took %.2f ms for %d months (budget %.2f ms)."),
+                    RequestId, Report.ElapsedMilliseconds, Report.MonthsSimulated, BudgetMilliseconds);
+            }
+
+            FGameThreadCommandQueue::Get().Enqueue([Report = MoveTemp(Report), WeakThis, OnComplete]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    OnComplete.ExecuteIfBound(Report);
+                }
+            });
+        });
+
+    return RequestId;
+}
+
+FSimulationForkState USimulationPreviewSubsystem::ForkLiveState()
+{
+    check(IsInGameThread());
+
+    if (IsForkPointStale())
+    {
+        CaptureForkPoint();
+    }
+
+    return ForkPoint;
+}
+
+bool USimulationPreviewSubsystem::IsForkPointStale() const
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    const UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>();
+    const USongManagerSubsystem* SongManager = GameInstance->GetSubsystem<USongManagerSubsystem>();
+    const UArtistManagerSubsystem* ArtistManager = GameInstance->GetSubsystem<UArtistManagerSubsystem>();
+
+    // Songs and contract financials only change when a month is published, which also replaces the chart.
+    return !TimeSubsystem || !SongManager || !ArtistManager
+        || ForkPointMonth != TimeSubsystem->GetCurrentMonth()
+        || ForkPointChart != SongManager->GetChartSnapshot()
+        || ForkPointNumSongs != SongManager->GetAllActiveSongs().Num()
+        || ForkPoint.CampaignSeed != SongManager->GetCampaignSeed()
+        || ForkPointRosterVersion != ArtistManager->GetRosterVersion();
+}
+
+void USimulationPreviewSubsystem::CaptureForkPoint()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(USimulationPreviewSubsystem::CaptureForkPoint);
+
+    // Dropping the old fork point never disturbs previews in flight; they hold their own chunk references.
+    ForkPoint = FSimulationForkState();
+
+    UGameInstance* GameInstance = GetGameInstance();
+    const UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>();
+    const USongManagerSubsystem* SongManager = GameInstance->GetSubsystem<USongManagerSubsystem>();
+    const UArtistManagerSubsystem* ArtistManager = GameInstance->GetSubsystem<UArtistManagerSubsystem>();
+
+    ForkPointMonth = TimeSubsystem ? TimeSubsystem->GetCurrentMonth() : UGameTimeSubsystem::GetFirstMonth();
+    ForkPoint.Month = ForkPointMonth;
+
+    if (SongManager)
+    {
+        const TArray<TObjectPtr<USong>>& ActiveSongs = SongManager->GetAllActiveSongs();
+
+        TSharedRef<TArray<FString>, ESPMode::ThreadSafe> SongIds = MakeShared<TArray<FString>, ESPMode::ThreadSafe>();
+        SongIds->Reserve(ActiveSongs.Num());
+
+        // Kept in ActiveSongs order so the fork draws its random rolls in the same order as the live step.
+        for (const TObjectPtr<USong>& Song : ActiveSongs)
+        {
+            if (Song)
+            {
+                FSimulationForkState::FSong ForkSong;
+                ForkSong.State = MusicSimulation::MakeSongState(Song->Data);
+                ForkSong.ActiveFrom = ForkPointMonth + 1;
+                ForkPoint.Songs.Add(ForkSong);
+                SongIds->Add(Song->SongId);
+            }
+        }
+
+        ForkPoint.SongIds = SongIds;
+        ForkPoint.CampaignSeed = SongManager->GetCampaignSeed();
+        ForkPointChart = SongManager->GetChartSnapshot();
+        ForkPointNumSongs = ActiveSongs.Num();
+    }
+
+    if (ArtistManager)
+    {
+        for (const FArtistContract& Contract : ArtistManager->ActiveContracts)
+        {
+            FSimulationForkState::FContract ForkContract;
+            ForkContract.State = MusicSimulation::MakeContractState(Contract);
+            ForkContract.ActiveFrom = ForkPointMonth + 1;
+            ForkContract.ExpiryMonth = MusicSimulation::GetContractExpiryMonth(Contract, ForkPointMonth);
+            ForkPoint.Contracts.Add(ForkContract);
+        }
+
+        ForkPointRosterVersion = ArtistManager->GetRosterVersion();
+    }
+}
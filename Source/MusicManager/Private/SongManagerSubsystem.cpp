@@ -1,14 +1,28 @@
 #include "SongManagerSubsystem.h"
 
 #include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Math/RandomStream.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformTime.h"
 #include "FSongData.h"
 #include "GameTimeSubsystem.h"
+#include "MusicManagerStats.h"
 #include "MusicSaveGame.h"
+#include "NewsGeneratorSubsystem.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "SimulationModels.h"
 #include "Math/UnrealMathUtility.h"
 #include "Misc/DateTime.h"
 #include "Song.h"
+#include "UObject/StrongObjectPtr.h"
+
+DECLARE_CYCLE_STAT(TEXT("Songs StepMonth"), STAT_SongsStepMonth, STATGROUP_MusicSimulation);
+DECLARE_CYCLE_STAT(TEXT("Songs PublishMonth"), STAT_SongsPublishMonth, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Songs"), STAT_ActiveSongs, STATGROUP_MusicSimulation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Archived Songs"), STAT_ArchivedSongs, STATGROUP_MusicSimulation);
 
 void USongManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -16,13 +30,19 @@ void USongManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
     Super::Initialize(Collection);
 
-    if (UGameInstance* GameInstance = GetGameInstance())
+    Collection.InitializeDependency<UGameCalendarSubsystem>();
+
+    // A new game instance starts a new campaign; loading a save replaces the seed with the campaign's own.
+    CampaignSeed = MusicSimulation::MakeCampaignSeed();
+
+    if (UGameTimeSubsystem* TimeSubsystem = Collection.InitializeDependency<UGameTimeSubsystem>())
     {
-        if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
-        {
-            // Listen for global month advancement events to drive popularity simulation.
-            TimeSubsystem->OnMonthAdvanced.AddDynamic(this, &USongManagerSubsystem::HandleMonthAdvanced);
-        }
+        // Join the month pipeline to drive popularity simulation.
+        MonthStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::Songs, TEXT("Songs"),
+            FMonthStageDelegate::CreateUObject(this, &USongManagerSubsystem::StepMonth), EMonthStageThread::Worker);
+        PublishStageHandle = TimeSubsystem->RegisterMonthStage(EMonthPhase::News, TEXT("SongsPublish"),
+            FMonthStageDelegate::CreateUObject(this, &USongManagerSubsystem::PublishMonth));
+        MonthBegunHandle = TimeSubsystem->OnMonthBegun.AddUObject(this, &USongManagerSubsystem::HandleMonthBegun);
     }
 }
 
@@ -35,10 +55,14 @@ void USongManagerSubsystem::Deinitialize()
         if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
         {
             // Clean up bindings so the subsystem can be garbage collected correctly.
-            TimeSubsystem->OnMonthAdvanced.RemoveDynamic(this, &USongManagerSubsystem::HandleMonthAdvanced);
+            TimeSubsystem->UnregisterMonthStage(MonthStageHandle);
+            TimeSubsystem->UnregisterMonthStage(PublishStageHandle);
+            TimeSubsystem->OnMonthBegun.Remove(MonthBegunHandle);
         }
     }
 
+    Commands.Reset();
+
     Super::Deinitialize();
 }
 
@@ -58,7 +82,7 @@ USong* USongManagerSubsystem::CreateSong(const FString& ArtistId, const FString&
         {
             if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
             {
-                return TimeSubsystem->GetCurrentGameDate().GetYear();
+                return TimeSubsystem->GetCurrentMonth().GetYear();
             }
         }
         return FDateTime::Now().GetYear();
@@ -92,13 +116,17 @@ USong* USongManagerSubsystem::CreateSong(const FString& ArtistId, const FString&
 
     NewSong->Initialize(ArtistId, SongData);
 
-    // Store the reference so every subsystem can query the authoritative list.
-    ActiveSongs.Add(NewSong);
+    // Store the reference so every subsystem can query the authoritative list. The strong pointer keeps the
+    // song alive if the command has to wait for the month step.
+    Commands.Run([this, PendingSong = TStrongObjectPtr<USong>(NewSong)]()
+    {
+        AddActiveSong(PendingSong.Get());
+    });
 
     return NewSong;
 }
 
-void USongManagerSubsystem::ReleaseSong(USong* Song, const FDateTime& ReleaseDate)
+void USongManagerSubsystem::ReleaseSong(USong* Song, const FGameMonth& ReleaseMonth)
 {
     ensure(IsInGameThread());
 
@@ -107,83 +135,138 @@ void USongManagerSubsystem::ReleaseSong(USong* Song, const FDateTime& ReleaseDat
         return;
     }
 
-    // Keep the core identity information synchronized with the release date.
-    Song->Data.YearCreated = ReleaseDate.GetYear();
-    Song->Data.ReleaseYear = ReleaseDate.GetYear();
-    Song->Data.ReleaseMonth = ReleaseDate.GetMonth();
+    // Keep the core identity information synchronized with the release month.
+    Song->Data.YearCreated = ReleaseMonth.GetYear();
+    Song->Data.ReleaseMonth = ReleaseMonth;
     Song->Data.bIsReleased = true;
 
+    // A manual release supersedes any scheduled one.
+    FCalendarEventHandle PendingRelease;
+    if (PendingReleases.RemoveAndCopyValue(Song, PendingRelease))
+    {
+        if (UGameCalendarSubsystem* Calendar = GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>())
+        {
+            Calendar->CancelEvent(PendingRelease);
+        }
+    }
+
     // Notify any listeners (UI, news feed, etc.).
     OnSongReleased.Broadcast(Song);
 }
 
-void USongManagerSubsystem::HandleMonthAdvanced(const FDateTime& /*NewDate*/)
+void USongManagerSubsystem::ScheduleSongRelease(USong* Song, const FGameMonth& ReleaseMonth)
 {
     ensure(IsInGameThread());
 
-    // Run the simulation step for every active song.
-    for (const TObjectPtr<USong>& SongPtr : ActiveSongs)
+    UGameCalendarSubsystem* Calendar = GetGameInstance() ? GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>() : nullptr;
+    if (!Song || !Calendar || !ReleaseMonth.IsValid())
     {
-        if (USong* Song = SongPtr.Get())
-        {
-            UpdateSongForNewMonth(Song);
-        }
+        return;
     }
 
-    // Determine which songs should be archived after updates.
-    TArray<USong*> SongsToArchive;
-    for (const TObjectPtr<USong>& SongPtr : ActiveSongs)
-    {
-        if (USong* Song = SongPtr.Get())
+    // Stored on the song so a save taken before the release can reschedule it on load.
+    Song->Data.ReleaseMonth = ReleaseMonth;
+
+    FCalendarEventHandle& PendingRelease = PendingReleases.FindOrAdd(Song);
+    Calendar->CancelEvent(PendingRelease);
+    PendingRelease = Calendar->ScheduleEvent(ReleaseMonth, EMonthPhase::Songs,
+        FCalendarEventDelegate::CreateWeakLambda(this, [this, WeakSong = TWeakObjectPtr<USong>(Song)](const FGameMonth& DueMonth)
         {
-            if (Song->Data.CurrentPopularity < 5.f)
+            PendingReleases.Remove(WeakSong);
+            if (USong* ScheduledSong = WeakSong.Get())
             {
-                SongsToArchive.Add(Song);
+                ReleaseSong(ScheduledSong, DueMonth);
             }
-        }
-    }
+        }));
+}
+
+void USongManagerSubsystem::HandleMonthBegun(const FGameMonth& /*PendingMonth*/)
+{
+    // The worker stage owns SimSongs from now until PublishMonth.
+    Commands.Hold();
+}
 
-    for (USong* Song : SongsToArchive)
+bool USongManagerSubsystem::StepMonth(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
+{
+    // Runs on a worker: only SimSongs and PendingChartOrder may be touched here, never the USong objects.
+    TRACE_CPUPROFILER_EVENT_SCOPE(USongManagerSubsystem::StepMonth);
+    SCOPE_CYCLE_COUNTER(STAT_SongsStepMonth);
+    LLM_SCOPE_BYNAME(TEXT("MusicSim/Songs"));
+
+    FRandomStream Stream = MusicSimulation::MakeViralRollStream(CampaignSeed, NewMonth);
+    PendingChartEntries.Reset();
+    for (int32 SongIndex = 0; SongIndex < SimSongs.Num(); ++SongIndex)
     {
-        ArchiveSong(Song);
+        FSongSimState& State = SimSongs[SongIndex];
+        const bool bWasCharting = State.ChartWeeks > 0;
+        MusicSimulation::StepSongMonth(State, Stream.FRandRange(0.f, MusicSimulation::MaxViralRoll));
+
+        if (!bWasCharting && State.ChartWeeks > 0)
+        {
+            PendingChartEntries.Add(SongIndex);
+        }
     }
+
+    RankSimSongs(PendingChartOrder);
+
+    Cursor = SimSongs.Num();
+    return true;
 }
 
-TArray<USong*> USongManagerSubsystem::GetTopSongs(int32 Count) const
+bool USongManagerSubsystem::PublishMonth(const FGameMonth& NewMonth, int32& Cursor, double /*DeadlineSeconds*/)
 {
     ensure(IsInGameThread());
+    TRACE_CPUPROFILER_EVENT_SCOPE(USongManagerSubsystem::PublishMonth);
+    SCOPE_CYCLE_COUNTER(STAT_SongsPublishMonth);
 
-    TArray<USong*> SortedSongs;
-    SortedSongs.Reserve(ActiveSongs.Num());
-
-    for (const TObjectPtr<USong>& SongPtr : ActiveSongs)
+    check(SimSongs.Num() == ActiveSongs.Num());
+    for (int32 SongIndex = 0; SongIndex < SimSongs.Num(); ++SongIndex)
     {
-        if (USong* Song = SongPtr.Get())
+        if (USong* Song = ActiveSongs[SongIndex].Get())
         {
-            SortedSongs.Add(Song);
+            Song->Data.CurrentPopularity = SimSongs[SongIndex].CurrentPopularity;
+            Song->Data.ChartWeeks = SimSongs[SongIndex].ChartWeeks;
         }
     }
 
-    SortedSongs.Sort([](const USong& A, const USong& B)
-        {
-            return A.Data.CurrentPopularity > B.Data.CurrentPopularity;
-        });
+    // Ranked before archiving, since the order refers to this month's indices.
+    SubmitChartNews(PendingChartOrder);
+    PublishChart(NewMonth, PendingChartOrder);
+    ArchiveFadedSongs();
 
-    if (Count <= 0)
-    {
-        return {};
-    }
+    Cursor = ActiveSongs.Num();
 
-    if (SortedSongs.Num() <= Count)
+    // Songs created during the step join now and are first simulated next month.
+    Commands.Release();
+
+    SET_DWORD_STAT(STAT_ActiveSongs, ActiveSongs.Num());
+    SET_DWORD_STAT(STAT_ArchivedSongs, ArchivedSongs.Num());
+
+    return true;
+}
+
+TArray<USong*> USongManagerSubsystem::GetTopSongs(int32 Count) const
+{
+    ensure(IsInGameThread());
+
+    TArray<USong*> Result;
+    if (Count <= 0)
     {
-        return SortedSongs;
+        return Result;
     }
 
-    TArray<USong*> Result;
-    Result.Reserve(Count);
-    for (int32 Index = 0; Index < Count; ++Index)
+    // Ranked once per month by the worker stage instead of sorting on every query.
+    Result.Reserve(FMath::Min(Count, ChartSnapshot->SongsByPopularity.Num()));
+    for (const TWeakObjectPtr<USong>& SongPtr : ChartSnapshot->SongsByPopularity)
     {
-        Result.Add(SortedSongs[Index]);
+        if (USong* Song = SongPtr.Get())
+        {
+            Result.Add(Song);
+            if (Result.Num() == Count)
+            {
+                break;
+            }
+        }
     }
     return Result;
 }
@@ -240,6 +323,8 @@ void USongManagerSubsystem::SaveState(UMusicSaveGame* SaveObject)
 
     AppendSongs(ActiveSongs);
     AppendSongs(ArchivedSongs);
+
+    SaveObject->CampaignSeed = CampaignSeed;
 }
 
 void USongManagerSubsystem::LoadState(const UMusicSaveGame* SaveObject)
@@ -251,8 +336,24 @@ void USongManagerSubsystem::LoadState(const UMusicSaveGame* SaveObject)
         return;
     }
 
+    // Callers settle the month in flight first, so nothing deferred can still apply to the old songs.
+    ensure(!Commands.IsHeld());
+    Commands.Reset();
+
     ActiveSongs.Reset();
     ArchivedSongs.Reset();
+    SimSongs.Reset();
+
+    CampaignSeed = SaveObject->CampaignSeed;
+
+    if (UGameCalendarSubsystem* Calendar = GetGameInstance() ? GetGameInstance()->GetSubsystem<UGameCalendarSubsystem>() : nullptr)
+    {
+        for (TPair<TWeakObjectPtr<USong>, FCalendarEventHandle>& PendingRelease : PendingReleases)
+        {
+            Calendar->CancelEvent(PendingRelease.Value);
+        }
+    }
+    PendingReleases.Reset();
 
     for (const FSavedSong& SavedSong : SaveObject->SavedSongs)
     {
@@ -269,56 +370,139 @@ void USongManagerSubsystem::LoadState(const UMusicSaveGame* SaveObject)
         NewSong->SongId = SavedSong.SongId;
         NewSong->Data = SavedSong.Data;
 
-        if (NewSong->Data.CurrentPopularity < 5.f)
+        if (NewSong->Data.CurrentPopularity < MusicSimulation::ArchivePopularity)
         {
             ArchivedSongs.Add(NewSong);
         }
         else
         {
-            ActiveSongs.Add(NewSong);
+            AddActiveSong(NewSong);
+        }
+
+        if (!NewSong->Data.bIsReleased && NewSong->Data.ReleaseMonth.IsValid())
+        {
+            ScheduleSongRelease(NewSong, NewSong->Data.ReleaseMonth);
         }
     }
+
+    TArray<int32> Order;
+    RankSimSongs(Order);
+    PublishChart(FGameMonth(), Order);
 }
 
-void USongManagerSubsystem::UpdateSongForNewMonth(USong* Song)
+void USongManagerSubsystem::AddActiveSong(USong* Song)
 {
     ensure(IsInGameThread());
+    check(!Commands.IsHeld());
 
     if (!Song)
     {
         return;
     }
 
-    // Core simulation step: adjust popularity based on creative quality and market factors.
-    const float BaseGrowth = Song->Data.HitPotential * 0.05f;           // Great songs grow faster in general.
-    const float InnovationBoost = Song->Data.Innovation * 0.02f;         // Innovation keeps the track exciting.
-    const float TrendFactor = Song->Data.TrendAlignment * 0.03f;         // Trend alignment rides cultural waves.
-    const float ViralBoost = Song->Data.ViralPotential * FMath::FRandRange(0.0f, 0.4f); // Random viral spikes.
-    const float AgingDecay = Song->Data.ChartWeeks * 0.4f;               // Songs cool off over time.
+    ActiveSongs.Add(Song);
+    SimSongs.Add(MusicSimulation::MakeSongState(Song->Data));
+}
 
-    Song->Data.CurrentPopularity += BaseGrowth + InnovationBoost + TrendFactor + ViralBoost - AgingDecay;
-    Song->Data.CurrentPopularity = FMath::Clamp(Song->Data.CurrentPopularity, 0.0f, 100.0f);
+void USongManagerSubsystem::ArchiveFadedSongs()
+{
+    ensure(IsInGameThread());
 
-    if (Song->Data.CurrentPopularity > 20.f)
+    // Stable compaction so both arrays stay aligned and surviving songs keep their order.
+    int32 WriteIndex = 0;
+    for (int32 ReadIndex = 0; ReadIndex < ActiveSongs.Num(); ++ReadIndex)
     {
-        // Songs that remain relevant accumulate chart weeks.
-        ++Song->Data.ChartWeeks;
+        USong* Song = ActiveSongs[ReadIndex].Get();
+        if (!Song)
+        {
+            continue;
+        }
+
+        if (SimSongs[ReadIndex].CurrentPopularity < MusicSimulation::ArchivePopularity)
+        {
+            ArchivedSongs.Add(Song);
+            continue;
+        }
+
+        ActiveSongs[WriteIndex] = ActiveSongs[ReadIndex];
+        SimSongs[WriteIndex] = SimSongs[ReadIndex];
+        ++WriteIndex;
     }
+
+    ActiveSongs.SetNum(WriteIndex);
+    SimSongs.SetNum(WriteIndex);
 }
 
-void USongManagerSubsystem::ArchiveSong(USong* Song)
+void USongManagerSubsystem::RankSimSongs(TArray<int32>& OutOrder) const
+{
+    OutOrder.Reset(SimSongs.Num());
+    for (int32 SongIndex = 0; SongIndex < SimSongs.Num(); ++SongIndex)
+    {
+        // Songs about to be archived never make the chart.
+        if (SimSongs[SongIndex].CurrentPopularity >= MusicSimulation::ArchivePopularity)
+        {
+            OutOrder.Add(SongIndex);
+        }
+    }
+
+    Algo::StableSortBy(OutOrder, [this](int32 SongIndex)
+    {
+        return SimSongs[SongIndex].CurrentPopularity;
+    }, TGreater<>());
+}
+
+void USongManagerSubsystem::PublishChart(const FGameMonth& Month, const TArray<int32>& Order)
 {
     ensure(IsInGameThread());
 
-    if (!Song)
+    TSharedRef<FSongChartSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FSongChartSnapshot, ESPMode::ThreadSafe>();
+    Snapshot->Month = Month;
+    Snapshot->SongsByPopularity.Reserve(Order.Num());
+    for (const int32 SongIndex : Order)
+    {
+        Snapshot->SongsByPopularity.Add(ActiveSongs[SongIndex].Get());
+    }
+
+    ChartSnapshot = Snapshot;
+}
+
+void USongManagerSubsystem::SubmitChartNews(const TArray<int32>& Order)
+{
+    ensure(IsInGameThread());
+
+    UNewsGeneratorSubsystem* NewsGenerator = GetGameInstance() ? GetGameInstance()->GetSubsystem<UNewsGeneratorSubsystem>() : nullptr;
+    if (!NewsGenerator)
     {
         return;
     }
 
-    const int32 Index = ActiveSongs.IndexOfByKey(Song);
-    if (Index != INDEX_NONE)
+    const auto MakeCandidate = [this](ENewsCandidateKind Kind, int32 SongIndex)
     {
-        ActiveSongs.RemoveAtSwap(Index);
-        ArchivedSongs.Add(Song);
+        const USong* Song = ActiveSongs[SongIndex].Get();
+
+        FNewsCandidate Candidate;
+        Candidate.Kind = Kind;
+        Candidate.SubjectId = Song->SongId;
+        Candidate.SubjectName = Song->Data.SongName;
+        Candidate.Genre = Song->Data.Genre;
+        Candidate.Amount = SimSongs[SongIndex].CurrentPopularity;
+        Candidate.Magnitude = SimSongs[SongIndex].CurrentPopularity;
+        return Candidate;
+    };
+
+    // The published chart still holds last month's ranking.
+    const USong* PreviousTop = ChartSnapshot->SongsByPopularity.Num() > 0 ? ChartSnapshot->SongsByPopularity[0].Get() : nullptr;
+    if (Order.Num() > 0 && ActiveSongs[Order[0]] && ActiveSongs[Order[0]] != PreviousTop
+        && SimSongs[Order[0]].CurrentPopularity > MusicSimulation::ChartingPopularity)
+    {
+        NewsGenerator->AddCandidate(MakeCandidate(ENewsCandidateKind::NumberOne, Order[0]));
+    }
+
+    for (const int32 SongIndex : PendingChartEntries)
+    {
+        if (ActiveSongs[SongIndex])
+        {
+            NewsGenerator->AddCandidate(MakeCandidate(ENewsCandidateKind::ChartEntry, SongIndex));
+        }
     }
 }
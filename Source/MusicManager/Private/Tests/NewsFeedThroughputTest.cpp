@@ -0,0 +1,341 @@
+#include "EventSubsystem.h"
+#include "EventTickerWidget.h"
+#include "GameTimeSubsystem.h"
+#include "Layout.h"
+#include "MusicSaveGame.h"
+#include "UIManagerSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Posted per frame, like a burst of busy months at max speed. */
+    constexpr int32 EventsPerFrame = 1000;
+
+    // Budgets the feed is held to. Timings depend on the machine, so going over them only warns; the widget
+    // count is a limit of the virtualized feed and fails the test.
+    constexpr double MaxFeedMicrosecondsPerCard = 50.0;
+    constexpr double MaxWorstFrameMilliseconds = 100.0;
+    constexpr double MaxMemoryGrowthMegaBytes = 64.0;
+    constexpr int32 MaxExtraTickerWidgets = 64;
+
+    UWorld* FindGameWorld()
+    {
+        if (GEngine)
+        {
+            for (const FWorldContext& Context : GEngine->GetWorldContexts())
+            {
+                if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+                {
+                    return Context.World();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    int32 CountTickerWidgets()
+    {
+        TArray<UObject*> Widgets;
+        GetObjectsOfClass(UEventTickerWidget::StaticClass(), Widgets, true, RF_ClassDefaultObject | RF_ArchetypeObject);
+        return Widgets.Num();
+    }
+
+    /** A mix of templated and plain-text news across types, tags and sources, like a busy campaign. */
+    FMusicNewsEvent MakeEvent(int32 Index)
+    {
+        static const TCHAR* const Genres[] = { TEXT("Rock"), TEXT("Pop"), TEXT("Jazz"), TEXT("Soul"), TEXT("Folk") };
+        static const TCHAR* const Labels[] = { TEXT("Apex Records"), TEXT("Blue Door"), TEXT("Northstar Music") };
+
+        FMusicNewsEvent Event;
+        Event.Timestamp = FDateTime(1965, 1, 1) + FTimespan::FromHours(Index);
+        Event.Tags = { TEXT("Benchmark"), Genres[Index % UE_ARRAY_COUNT(Genres)] };
+        Event.ReputationDelta = Index % 7 - 3;
+        Event.TextAmount = static_cast<float>(Index % 1000);
+
+        switch (Index % 5)
+        {
+        case 0:
+            Event.NewsType = EMusicNewsType::ArtistSigned;
+            Event.TextTemplate = ENewsTextTemplate::ArtistSigned;
+            Event.SubjectName = FString::Printf(TEXT("Benchmark Artist %d"), Index % 500);
+            break;
+        case 1:
+            Event.NewsType = EMusicNewsType::ChartAchievement;
+            Event.TextTemplate = ENewsTextTemplate::ChartEntry;
+            Event.SubjectName = FString::Printf(TEXT("Benchmark Single %d"), Index % 2000);
+            break;
+        case 2:
+            Event.NewsType = EMusicNewsType::RivalLabelNews;
+            Event.TextTemplate = ENewsTextTemplate::RivalSigningSpree;
+            Event.SourceName = Labels[Index % UE_ARRAY_COUNT(Labels)];
+            break;
+        case 3:
+            Event.NewsType = EMusicNewsType::FinancialReport;
+            Event.TextTemplate = ENewsTextTemplate::RevenueMilestone;
+            Event.SubjectName = FString::Printf(TEXT("Benchmark Artist %d"), Index % 500);
+            break;
+        default:
+            Event.NewsType = EMusicNewsType::IndustryTrend;
+            Event.SourceName = TEXT("Global Market Desk");
+            Event.Headline = FString::Printf(TEXT("Benchmark trend report %d"), Index);
+            Event.BodyText = TEXT("Synthetic news posted by the feed throughput test.");
+            break;
+        }
+        return Event;
+    }
+
+    /**
+     * Posts NumEvents synthetic news items through the event subsystem, a batch per frame, with the layout's
+     * ticker bypassed so every item is inserted into the feed rather than rate limited or rolled up. Frame time,
+     * process memory and live ticker widgets are sampled every frame.
+     *
+     * Time is paused and the news history is saved first, and both are put back afterwards, so the session and
+     * its next save never see the synthetic news.
+     */
+    class FNewsFeedThroughputCommand : public IAutomationLatentCommand
+    {
+    public:
+        FNewsFeedThroughputCommand(FAutomationTestBase& InTest, UEventSubsystem& InEventSubsystem, ULayout& InLayout, int32 InNumEvents)
+            : Test(InTest)
+            , EventSubsystem(&InEventSubsystem)
+            , Layout(&InLayout)
+            , NumEvents(InNumEvents)
+        {
+        }
+
+        virtual bool Update() override
+        {
+            UEventSubsystem* Subsystem = EventSubsystem.Get();
+            ULayout* FeedLayout = Layout.Get();
+            if (!Subsystem || !FeedLayout)
+            {
+                Test.AddError(TEXT("The event subsystem or layout went away during the run."));
+                if (Subsystem && bStarted)
+                {
+                    End(*Subsystem, FeedLayout);
+                }
+                return true;
+            }
+
+            if (!bStarted)
+            {
+                Begin(*Subsystem, *FeedLayout);
+                return false;
+            }
+
+            // The frame that just ended is the one that posted the previous batch.
+            if (NumPosted > 0)
+            {
+                WorstFrameSeconds = FMath::Max(WorstFrameSeconds, FApp::GetDeltaTime());
+            }
+            Sample();
+
+            if (NumPosted < NumEvents)
+            {
+                PostBatch(*Subsystem);
+                return false;
+            }
+
+            Report(*FeedLayout);
+            End(*Subsystem, FeedLayout);
+            return true;
+        }
+
+    private:
+        void Begin(UEventSubsystem& Subsystem, ULayout& FeedLayout)
+        {
+            bStarted = true;
+
+            // A month in flight or a new one would post news of its own, which the restore below would drop.
+            if (UGameTimeSubsystem* TimeSubsystem = Subsystem.GetGameInstance()->GetSubsystem<UGameTimeSubsystem>())
+            {
+                bResumeTime = TimeSubsystem->IsTimeRunning();
+                TimeSubsystem->PauseTime(true);
+                TimeSubsystem->FlushPendingMonth();
+            }
+
+            SavedHistory.Reset(NewObject<UMusicSaveGame>());
+            Subsystem.SaveState(SavedHistory.Get());
+
+            FeedLayout.SetNewsTickerBypassed(true);
+            StartTotals = FeedLayout.GetNewsTickerTotals();
+
+            BaselineUsedBytes = FPlatformMemory::GetStats().UsedPhysical;
+            BaselineWidgets = CountTickerWidgets();
+            Batch.Reserve(EventsPerFrame);
+        }
+
+        void PostBatch(UEventSubsystem& Subsystem)
+        {
+            // Built ahead of time so only posting is timed.
+            Batch.Reset();
+            const int32 NumToPost = FMath::Min(EventsPerFrame, NumEvents - NumPosted);
+            for (int32 Offset = 0; Offset < NumToPost; ++Offset)
+            {
+                Batch.Add(MakeEvent(NumPosted + Offset));
+            }
+
+            const double BatchStart = FPlatformTime::Seconds();
+            for (const FMusicNewsEvent& Event : Batch)
+            {
+                Subsystem.PostNews(Event);
+            }
+            PostSeconds += FPlatformTime::Seconds() - BatchStart;
+            NumPosted += NumToPost;
+        }
+
+        void Sample()
+        {
+            PeakUsedBytes = FMath::Max(PeakUsedBytes, static_cast<uint64>(FPlatformMemory::GetStats().UsedPhysical));
+            PeakWidgets = FMath::Max(PeakWidgets, CountTickerWidgets());
+        }
+
+        void Report(const ULayout& FeedLayout)
+        {
+            const double MegaByte = 1024.0 * 1024.0;
+            const FNewsTickerTotals& Totals = FeedLayout.GetNewsTickerTotals();
+            const int32 NumCards = Totals.NumCards - StartTotals.NumCards;
+            const double FeedSeconds = Totals.FeedSeconds - StartTotals.FeedSeconds;
+
+            const double EventsPerSecond = PostSeconds > 0.0 ? NumPosted / PostSeconds : 0.0;
+            const double FeedMicrosecondsPerCard = NumCards > 0 ? FeedSeconds * 1000000.0 / NumCards : 0.0;
+            const double WorstFrameMilliseconds = WorstFrameSeconds * 1000.0;
+            const double MemoryGrowthMegaBytes = (static_cast<double>(PeakUsedBytes) - static_cast<double>(BaselineUsedBytes)) / MegaByte;
+            const int32 ExtraWidgets = PeakWidgets - BaselineWidgets;
+
+            Test.AddInfo(FString::Printf(TEXT("%d events, %d per frame: %.0f events/s posted, %d cards inserted at %.2f us each"),
+                NumPosted, EventsPerFrame, EventsPerSecond, NumCards, FeedMicrosecondsPerCard));
+            Test.AddInfo(FString::Printf(TEXT("Worst frame %.3f ms; memory peak %+.1f MB over the start; ticker widgets peak %d (%+d)"),
+                WorstFrameMilliseconds, MemoryGrowthMegaBytes, PeakWidgets, ExtraWidgets));
+
+            const FString Context = FString::Printf(TEXT("%d events"), NumEvents);
+            Test.AddTelemetryData(TEXT("EventsPerSecond"), EventsPerSecond, Context);
+            Test.AddTelemetryData(TEXT("FeedMicrosecondsPerCard"), FeedMicrosecondsPerCard, Context);
+            Test.AddTelemetryData(TEXT("WorstFrameMilliseconds"), WorstFrameMilliseconds, Context);
+            Test.AddTelemetryData(TEXT("MemoryGrowthMegaBytes"), MemoryGrowthMegaBytes, Context);
+            Test.AddTelemetryData(TEXT("PeakTickerWidgets"), PeakWidgets, Context);
+
+            if (NumCards != NumPosted)
+            {
+                Test.AddError(FString::Printf(TEXT("%d events were posted but %d reached the feed."), NumPosted, NumCards));
+            }
+            if (FeedMicrosecondsPerCard > MaxFeedMicrosecondsPerCard)
+            {
+                Test.AddWarning(FString::Printf(TEXT("Feed insertion took %.2f us per card, over the budget of %.2f us."),
+                    FeedMicrosecondsPerCard, MaxFeedMicrosecondsPerCard));
+            }
+            if (WorstFrameMilliseconds > MaxWorstFrameMilliseconds)
+            {
+                Test.AddWarning(FString::Printf(TEXT("Worst frame took %.3f ms, over the budget of %.3f ms."),
+                    WorstFrameMilliseconds, MaxWorstFrameMilliseconds));
+            }
+            if (MemoryGrowthMegaBytes > MaxMemoryGrowthMegaBytes)
+            {
+                Test.AddWarning(FString::Printf(TEXT("Memory grew by %.1f MB, over the budget of %.1f MB."),
+                    MemoryGrowthMegaBytes, MaxMemoryGrowthMegaBytes));
+            }
+            if (ExtraWidgets > MaxExtraTickerWidgets)
+            {
+                Test.AddError(FString::Printf(TEXT("The feed created %d ticker widgets; a virtualized feed needs at most %d."),
+                    ExtraWidgets, MaxExtraTickerWidgets));
+            }
+        }
+
+        void End(UEventSubsystem& Subsystem, ULayout* FeedLayout)
+        {
+            if (FeedLayout)
+            {
+                FeedLayout->SetNewsTickerBypassed(false);
+            }
+
+            // As after a load: the saved history comes back and the UI is rebuilt on it, dropping the feed's
+            // view of the synthetic items.
+            Subsystem.LoadState(SavedHistory.Get());
+            SavedHistory.Reset();
+
+            UGameInstance* GameInstance = Subsystem.GetGameInstance();
+            if (UUIManagerSubsystem* UIManager = GameInstance->GetSubsystem<UUIManagerSubsystem>())
+            {
+                UIManager->RebuildUI();
+            }
+            if (UGameTimeSubsystem* TimeSubsystem = GameInstance->GetSubsystem<UGameTimeSubsystem>())
+            {
+                TimeSubsystem->PauseTime(!bResumeTime);
+            }
+        }
+
+        FAutomationTestBase& Test;
+        TWeakObjectPtr<UEventSubsystem> EventSubsystem;
+        TWeakObjectPtr<ULayout> Layout;
+
+        const int32 NumEvents;
+        int32 NumPosted = 0;
+        bool bStarted = false;
+        bool bResumeTime = false;
+
+        /** The session's news history while the run replaces it. */
+        TStrongObjectPtr<UMusicSaveGame> SavedHistory;
+
+        FNewsTickerTotals StartTotals;
+        uint64 BaselineUsedBytes = 0;
+        uint64 PeakUsedBytes = 0;
+        int32 BaselineWidgets = 0;
+        int32 PeakWidgets = 0;
+
+        double PostSeconds = 0.0;
+        double WorstFrameSeconds = 0.0;
+
+        TArray<FMusicNewsEvent> Batch;
+    };
+}
+
+/**
+ * Feed throughput at 10k and 100k posted news items. Needs a running game with its layout, e.g.
+ * MusicManager -game -nullrhi -ExecCmds="Automation RunTests MusicManager.News.FeedThroughput; Quit".
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FNewsFeedThroughputTest, "MusicManager.News.FeedThroughput",
+    EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FNewsFeedThroughputTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    OutBeautifiedNames.Add(TEXT("10k"));
+    OutTestCommands.Add(TEXT("10000"));
+    OutBeautifiedNames.Add(TEXT("100k"));
+    OutTestCommands.Add(TEXT("100000"));
+}
+
+bool FNewsFeedThroughputTest::RunTest(const FString& Parameters)
+{
+    int32 NumEvents = 0;
+    LexFromString(NumEvents, *Parameters);
+    if (NumEvents <= 0)
+    {
+        AddError(FString::Printf(TEXT("Invalid event count '%s'."), *Parameters));
+        return false;
+    }
+
+    UWorld* World = FindGameWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    UEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UEventSubsystem>() : nullptr;
+    ULayout* Layout = EventSubsystem ? EventSubsystem->GetLayout() : nullptr;
+    if (!Layout)
+    {
+        AddError(TEXT("Needs a running game with its layout, e.g. -game -nullrhi."));
+        return false;
+    }
+
+    ADD_LATENT_AUTOMATION_COMMAND(FNewsFeedThroughputCommand(*this, *EventSubsystem, *Layout, NumEvents));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,8 +3,8 @@
 #include "Components/HorizontalBox.h"
 #include "Components/HorizontalBoxSlot.h"
 #include "UI/CommandItemWidget.h"
-#include "Async/Async.h"
 #include "Engine/StreamableManager.h"
+#include "GameThreadCommandQueue.h"
 #include "Engine/Texture2D.h"
 #include "UIManagerSubsystem.h"
 
@@ -156,14 +156,11 @@ void UCommandPanelWidget::OnIconLoadedInternal(const FSoftObjectPath& LoadedPath
 {
     if (!IsInGameThread())
     {
-        const TWeakObjectPtr<UCommandPanelWidget> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, LoadedPath, LoadedObject, Definition]()
-        {
-            if (UCommandPanelWidget* StrongThis = WeakThis.Get())
+        FGameThreadCommandQueue::Get().Enqueue(this,
+            [LoadedPath, WeakLoaded = TWeakObjectPtr<UObject>(LoadedObject), Definition = MoveTemp(Definition)](UCommandPanelWidget& Self) mutable
             {
-                StrongThis->OnIconLoadedInternal(LoadedPath, LoadedObject, Definition);
-            }
-        });
+                Self.OnIconLoadedInternal(LoadedPath, WeakLoaded.Get(), MoveTemp(Definition));
+            });
         return;
     }
 
@@ -187,13 +184,9 @@ void UCommandPanelWidget::HandleIconLoaded(FCommandDefinition Definition)
 {
     if (!IsInGameThread())
     {
-        const TWeakObjectPtr<UCommandPanelWidget> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, Definition]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [Definition = MoveTemp(Definition)](UCommandPanelWidget& Self) mutable
         {
-            if (UCommandPanelWidget* StrongThis = WeakThis.Get())
-            {
-                StrongThis->HandleIconLoaded(Definition);
-            }
+            Self.HandleIconLoaded(MoveTemp(Definition));
         });
         return;
     }
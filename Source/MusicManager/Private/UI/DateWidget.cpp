@@ -2,6 +2,7 @@
 
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 void UDateWidget::NativeConstruct()
 {
@@ -21,8 +22,9 @@ void UDateWidget::NativeConstruct()
 
     if (TimeSys)
     {
-        TimeSys->OnMonthAdvanced.AddDynamic(this, &UDateWidget::HandleMonthAdvanced);
-        HandleMonthAdvanced(TimeSys->GetCurrentGameDate());
+        MonthStageHandle = TimeSys->RegisterMonthStage(EMonthPhase::UI, TEXT("DateWidget"),
+            FMonthStageDelegate::CreateUObject(this, &UDateWidget::HandleMonthAdvanced));
+        DisplayMonth(TimeSys->GetCurrentMonth());
     }
 }
 
@@ -36,7 +38,7 @@ void UDateWidget::NativeDestruct()
         {
             if (UGameTimeSubsystem* TimeSys = GameInstance->GetSubsystem<UGameTimeSubsystem>())
             {
-                TimeSys->OnMonthAdvanced.RemoveDynamic(this, &UDateWidget::HandleMonthAdvanced);
+                TimeSys->UnregisterMonthStage(MonthStageHandle);
             }
         }
     }
@@ -44,7 +46,14 @@ void UDateWidget::NativeDestruct()
     Super::NativeDestruct();
 }
 
-void UDateWidget::HandleMonthAdvanced(const FDateTime& NewDate)
+bool UDateWidget::HandleMonthAdvanced(const FGameMonth& NewMonth, int32& /*Cursor*/, double /*DeadlineSeconds*/)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UDateWidget::HandleMonthAdvanced);
+    DisplayMonth(NewMonth);
+    return true;
+}
+
+void UDateWidget::DisplayMonth(const FGameMonth& DisplayedMonth)
 {
     ensure(IsInGameThread());
 
@@ -52,8 +61,8 @@ void UDateWidget::HandleMonthAdvanced(const FDateTime& NewDate)
     {
         return;
     }
-    const int32 Year = NewDate.GetYear();
-    const int32 Month = NewDate.GetMonth(); // 112
+    const int32 Year = DisplayedMonth.GetYear();
+    const int32 Month = DisplayedMonth.GetMonth(); // 112
 
     static const FString MonthNames[12] = {
         TEXT("January"), TEXT("February"), TEXT("March"),
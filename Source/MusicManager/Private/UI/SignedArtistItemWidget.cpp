@@ -26,19 +26,24 @@ void USignedArtistItemWidget::NativeDestruct()
 
 void USignedArtistItemWidget::SetupItem(const FArtistData& InData, UTexture2D* PortraitTexture)
 {
+    // The panel calls this for every row on every roster change; only what actually changed is pushed to Slate.
+    const bool bNameChanged = !bHasArtistData || !LocalArtistData.ArtistName.Equals(InData.ArtistName, ESearchCase::CaseSensitive);
+    const bool bGenreChanged = !bHasArtistData || !LocalArtistData.Genre.Equals(InData.Genre, ESearchCase::CaseSensitive);
+    const bool bPortraitChanged = !bHasArtistData || (IsValid(PortraitImage) && PortraitImage->GetBrush().GetResourceObject() != PortraitTexture);
     LocalArtistData = InData;
+    bHasArtistData = true;
 
-    if (IsValid(ArtistNameText))
+    if (bNameChanged && IsValid(ArtistNameText))
     {
         ArtistNameText->SetText(FText::FromString(InData.ArtistName));
     }
 
-    if (IsValid(ArtistGenreText))
+    if (bGenreChanged && IsValid(ArtistGenreText))
     {
         ArtistGenreText->SetText(FText::FromString(InData.Genre));
     }
 
-    if (IsValid(PortraitImage))
+    if (bPortraitChanged && IsValid(PortraitImage))
     {
         FSlateBrush Brush;
         Brush.SetResourceObject(PortraitTexture);
@@ -1,9 +1,16 @@
 #include "UI/SignedArtistPanelWidget.h"
 
-#include "Async/Async.h"
 #include "Components/ScrollBox.h"
+#include "GameThreadCommandQueue.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "UI/SignedArtistItemWidget.h"
 
+USignedArtistPanelWidget::USignedArtistPanelWidget(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+    , ItemPool(*this)
+{
+}
+
 void USignedArtistPanelWidget::NativeConstruct()
 {
     Super::NativeConstruct();
@@ -11,29 +18,41 @@ void USignedArtistPanelWidget::NativeConstruct()
 
 void USignedArtistPanelWidget::NativeDestruct()
 {
-    for (TWeakObjectPtr<USignedArtistItemWidget>& ItemPtr : SpawnedItems)
+    // Rows stay bound to this panel, so they can come back from the pool as they are.
+    if (ArtistScrollBox)
     {
-        if (USignedArtistItemWidget* Item = ItemPtr.Get())
-        {
-            Item->OnArtistClicked.RemoveDynamic(this, &USignedArtistPanelWidget::HandleArtistItemClicked);
-        }
+        ArtistScrollBox->ClearChildren();
     }
-    SpawnedItems.Reset();
+    ItemsByArtist.Reset();
+    ItemPool.ReleaseAll();
+    DisplayedRoster.Reset();
 
     Super::NativeDestruct();
 }
 
+void USignedArtistPanelWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    ItemPool.ReleaseAllSlateResources();
+}
+
 void USignedArtistPanelWidget::PopulateArtistList(const TArray<FArtistData>& SignedArtists)
+{
+    // Ad-hoc lists carry version zero, which is always applied.
+    TSharedRef<FSignedRosterSnapshot, ESPMode::ThreadSafe> Roster = MakeShared<FSignedRosterSnapshot, ESPMode::ThreadSafe>();
+    Roster->Artists = SignedArtists;
+    PopulateArtistList(Roster);
+}
+
+void USignedArtistPanelWidget::PopulateArtistList(const FSignedRosterSnapshotRef& Roster)
 {
     if (!IsInGameThread())
     {
-        const TWeakObjectPtr<USignedArtistPanelWidget> WeakThis(this);
-        AsyncTask(ENamedThreads::GameThread, [WeakThis, SignedArtists]()
+        // Rosters that are already shown by the time this runs are skipped by their version below.
+        FGameThreadCommandQueue::Get().Enqueue(this, [Roster](USignedArtistPanelWidget& Self)
         {
-            if (USignedArtistPanelWidget* Strong = WeakThis.Get())
-            {
-                Strong->PopulateArtistList(SignedArtists);
-            }
+            Self.PopulateArtistList(Roster);
         });
         return;
     }
@@ -43,24 +62,101 @@ void USignedArtistPanelWidget::PopulateArtistList(const TArray<FArtistData>& Sig
         return;
     }
 
-    ArtistScrollBox->ClearChildren();
-    SpawnedItems.Reset();
+    if (Roster->Version != 0 && DisplayedRoster.IsValid() && DisplayedRoster->Version == Roster->Version)
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(USignedArtistPanelWidget::PopulateArtistList);
 
-    UWorld* World = GetWorld();
-    if (!World) return;
+    DisplayedRoster = Roster;
 
-    for (const FArtistData& Data : SignedArtists)
+    // Rows are matched to artists by name; whatever is left in PreviousItems afterwards has left the roster.
+    TMap<FString, TObjectPtr<USignedArtistItemWidget>> PreviousItems = MoveTemp(ItemsByArtist);
+    ItemsByArtist.Reset();
+    ItemsByArtist.Reserve(Roster->Artists.Num());
+
+    TArray<USignedArtistItemWidget*, TInlineAllocator<64>> OrderedItems;
+    OrderedItems.Reserve(Roster->Artists.Num());
+    for (const FArtistData& Data : Roster->Artists)
     {
-        USignedArtistItemWidget* Item = CreateWidget<USignedArtistItemWidget>(World, ItemClass);
-        if (!IsValid(Item)) continue;
+        // One row per artist, even if the list names one twice.
+        if (ItemsByArtist.Contains(Data.ArtistName))
+        {
+            continue;
+        }
+
+        TObjectPtr<USignedArtistItemWidget> Item;
+        if (!PreviousItems.RemoveAndCopyValue(Data.ArtistName, Item))
+        {
+            Item = AcquireItem();
+            if (!Item)
+            {
+                continue;
+            }
+        }
 
         Item->SetupItem(Data, nullptr);
+        ItemsByArtist.Add(Data.ArtistName, Item);
+        OrderedItems.Add(Item);
+    }
 
-        Item->OnArtistClicked.AddDynamic(this, &USignedArtistPanelWidget::HandleArtistItemClicked);
+    for (const TPair<FString, TObjectPtr<USignedArtistItemWidget>>& Removed : PreviousItems)
+    {
+        ReleaseItem(Removed.Value);
+    }
 
-        ArtistScrollBox->AddChild(Item);
-        SpawnedItems.Add(Item);
+    // Children that are already in the right slot are left alone, so an unchanged or appended-to roster only
+    // adds the new rows.
+    for (int32 Index = 0; Index < OrderedItems.Num(); ++Index)
+    {
+        USignedArtistItemWidget* Item = OrderedItems[Index];
+        if (ArtistScrollBox->GetChildAt(Index) == Item)
+        {
+            continue;
+        }
+
+        if (Item->GetParent() == ArtistScrollBox)
+        {
+            ArtistScrollBox->ShiftChild(Index, Item);
+        }
+        else if (Index == ArtistScrollBox->GetChildrenCount())
+        {
+            ArtistScrollBox->AddChild(Item);
+        }
+        else
+        {
+            ArtistScrollBox->InsertChildAt(Index, Item);
+        }
     }
+
+    // Anything past the rows is not ours, e.g. placeholder children from the designer.
+    while (ArtistScrollBox->GetChildrenCount() > OrderedItems.Num())
+    {
+        ArtistScrollBox->RemoveChildAt(ArtistScrollBox->GetChildrenCount() - 1);
+    }
+}
+
+USignedArtistItemWidget* USignedArtistPanelWidget::AcquireItem()
+{
+    USignedArtistItemWidget* Item = ItemPool.GetOrCreateInstance<USignedArtistItemWidget>(ItemClass);
+    if (IsValid(Item))
+    {
+        // Pooled rows keep their binding, so only rows that are new to this panel get one.
+        Item->OnArtistClicked.AddUniqueDynamic(this, &USignedArtistPanelWidget::HandleArtistItemClicked);
+    }
+    return Item;
+}
+
+void USignedArtistPanelWidget::ReleaseItem(USignedArtistItemWidget* Item)
+{
+    if (!Item)
+    {
+        return;
+    }
+
+    ArtistScrollBox->RemoveChild(Item);
+    ItemPool.Release(Item);
 }
 
 void USignedArtistPanelWidget::HandleArtistItemClicked(FString ArtistId)
@@ -60,33 +60,34 @@ void UUIManagerSubsystem::ShowAudition(const FAuditionEvent& EventData)
 
 void UUIManagerSubsystem::RefreshSignedArtistPanel()
 {
-    UGameInstance* GameInstance = GetGameInstance();
-    if (!IsValid(GameInstance))
-    {
-        return;
-    }
-
-    UArtistManagerSubsystem* ArtistManager = GameInstance->GetSubsystem<UArtistManagerSubsystem>();
-    if (!IsValid(ArtistManager))
-    {
-        return;
-    }
-
-    TArray<FArtistData> ArtistData;
-    ArtistManager->GetSignedArtistData(ArtistData);
-
-    const TWeakObjectPtr<ULayout> LayoutWeak = ActiveLayout;
-    AsyncTask(ENamedThreads::GameThread, [LayoutWeak, ArtistData]()
-    {
-        if (ULayout* Layout = LayoutWeak.Get())
+    // Every roster change asks for a refresh; requests made before the next drain collapse into one, which
+    // reads the roster as it is by then.
+    FGameThreadCommandQueue::Get().EnqueueUnique(this, TEXT("RefreshSignedArtistPanel"), [](UUIManagerSubsystem& Self)
+    {
+        UGameInstance* GameInstance = Self.GetGameInstance();
+        UArtistManagerSubsystem* ArtistManager = GameInstance ? GameInstance->GetSubsystem<UArtistManagerSubsystem>() : nullptr;
+        ULayout* Layout = Self.ActiveLayout.Get();
+        if (!IsValid(ArtistManager) || !IsValid(Layout))
         {
-            Layout->RefreshSignedArtists(ArtistData);
+            return;
         }
+
+        // The snapshot is shared rather than copied; the panel skips it if it already shows this version.
+        Layout->RefreshSignedArtistRoster(ArtistManager->GetSignedRosterSnapshot());
     });
 }
 
 void UUIManagerSubsystem::ShowContractForArtist(const FString& ArtistName)
 {
+    if (!IsInGameThread())
+    {
+        FGameThreadCommandQueue::Get().Enqueue(this, [ArtistName](UUIManagerSubsystem& Self)
+        {
+            Self.ShowContractForArtist(ArtistName);
+        });
+        return;
+    }
+
     UGameInstance* GameInstance = GetGameInstance();
     if (!IsValid(GameInstance))
     {
@@ -105,21 +106,18 @@ void UUIManagerSubsystem::ShowContractForArtist(const FString& ArtistName)
         return;
     }
 
-    const TWeakObjectPtr<ULayout> LayoutWeak = ActiveLayout;
-    AsyncTask(ENamedThreads::GameThread, [LayoutWeak, FoundContract = *Found]()
+    // Shown straight from the manager's copy; the contract widget takes its own.
+    if (ULayout* Layout = ActiveLayout.Get())
     {
-        if (ULayout* Layout = LayoutWeak.Get())
-        {
-            Layout->ShowContract(FoundContract);
-        }
-    });
+        Layout->ShowContract(*Found);
+    }
 }
 
-void UUIManagerSubsystem::HandleNewsCardSelected(const FMusicNewsEvent& EventData)
+void UUIManagerSubsystem::HandleNewsCardSelected(FNewsHandle News)
 {
-    ExecuteOnGameThread([this, EventData]()
+    ExecuteOnGameThread([this, News]()
     {
-        OnNewsSelected.Broadcast(EventData);
+        OnNewsSelected.Broadcast(News);
     });
 }
 
@@ -133,40 +131,18 @@ void UUIManagerSubsystem::HandleArtistSigned(const FArtistContract& Contract)
 
 void UUIManagerSubsystem::HandleArtistListChanged()
 {
-    TArray<FArtistData> ArtistDataList;
-
-    if (UArtistManagerSubsystem* ArtistSub = GetGameInstance()->GetSubsystem<UArtistManagerSubsystem>())
-    {
-        ArtistSub->GetSignedArtistData(ArtistDataList);
-    }
-
-    const TWeakObjectPtr<ULayout> RegisteredLayoutWeakPtr = ActiveLayout;
-    AsyncTask(ENamedThreads::GameThread, [RegisteredLayoutWeakPtr, ArtistDataList]()
-    {
-        if (ULayout* Layout = RegisteredLayoutWeakPtr.Get())
-        {
-            Layout->RefreshSignedArtists(ArtistDataList);
-        }
-    });
+    RefreshSignedArtistPanel();
 }
 
 void UUIManagerSubsystem::HandleCommandAction(const FString& CommandName)
 {
     UE_LOG(LogTemp, Display, TEXT("Handle Command"));
-    TWeakObjectPtr<UUIManagerSubsystem> WeakThis(this);
 
-    AsyncTask(ENamedThreads::GameThread, [WeakThis, CommandName]()
+    ExecuteOnGameThread([this, CommandName]()
     {
-        UUIManagerSubsystem* Self = WeakThis.Get();
-        if (!IsValid(Self))
-        {
-            UE_LOG(LogTemp, Display, TEXT("Self not valid"));
-            return;
-        }
-
         if (CommandName == TEXT("Contracts"))
         {
-            UGameInstance* GameInstance = Self->GetGameInstance();
+            UGameInstance* GameInstance = GetGameInstance();
             if (!IsValid(GameInstance))
             {
                 UE_LOG(LogUIManagerSubsystem, Warning, TEXT("HandleCommandAction: GameInstance is invalid."));
@@ -188,7 +164,7 @@ void UUIManagerSubsystem::HandleCommandAction(const FString& CommandName)
 
             const FArtistContract& Contract = ArtistSubsystem->ActiveContracts[0];
 
-            ULayout* Layout = Self->ActiveLayout.Get();
+            ULayout* Layout = ActiveLayout.Get();
             if (!IsValid(Layout))
             {
                 UE_LOG(LogUIManagerSubsystem, Warning, TEXT("HandleCommandAction: No active layout registered to show contracts."));
@@ -3,6 +3,14 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "FArtistContract.h"
+#include "FContractForecast.h"
+#include "DealRiskSimulator.h"
+#include "GameCalendarSubsystem.h"
+#include "NewsGeneratorSubsystem.h"
+#include "SignedRosterSnapshot.h"
+#include "SimulationCommandQueue.h"
+#include "SimulationModels.h"
+#include <atomic>
 #include "ArtistManagerSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnArtistSigned, const FArtistContract&, SignedContract);
@@ -10,9 +18,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnArtistRejected, const FString&, A
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnContractExpired, const FArtistContract&, ExpiredContract);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnContractsUpdated, const TArray<FArtistContract>&, UpdatedContracts);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnArtistListChanged);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnDealRiskAnalyzed, const FDealRiskReport&, Report);
 
 class UMusicSaveGame;
 
+/**
+ * Owns the player's contracts. Each active contract has a plain FContractSimState that a Contracts phase worker
+ * stage steps; the month's financials are written back into ActiveContracts from a News phase stage. Signings
+ * and expiries issued while a step is in flight wait in the command queue and apply right after that write-back.
+ */
 UCLASS()
 class UArtistManagerSubsystem : public UGameInstanceSubsystem
 {
@@ -20,6 +34,7 @@ class UArtistManagerSubsystem : public UGameInstanceSubsystem
 
 public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
 
     UFUNCTION(BlueprintCallable, Category="Contracts")
     void SignArtist(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo);
@@ -27,20 +42,41 @@ public:
     UFUNCTION(BlueprintCallable, Category="Contracts")
     void RejectArtist(const FString& ArtistId);
 
+    /** Settles one month for every active contract immediately, outside the month pipeline. */
     UFUNCTION(BlueprintCallable, Category="Contracts")
     void AdvanceMonth();
 
-    UFUNCTION()
-    void HandleMonthAdvanced(const FDateTime& NewDate);
+    /** Contracts phase worker stage: steps the simulated state of every active contract. */
+    bool StepMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+    /** News phase game-thread stage: writes the month's financials into ActiveContracts and applies deferred commands. */
+    bool PublishMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
 
     void ProcessMonthlyContractFinancials(FArtistContract& Contract);
 
+    /**
+     * Projects a proposed deal over its full length using the same model as ProcessMonthlyContractFinancials.
+     * Cheap enough to call on every slider change; OutForecast's arrays are reused between calls.
+     */
+    UFUNCTION(BlueprintCallable, Category="Contracts")
+    void ForecastDeal(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo, FContractForecast& OutForecast) const;
+
+    /**
+     * Runs a Monte Carlo risk analysis of a proposed deal on worker threads and reports P10/P50/P90 bands
+     * on the game thread. Starting a new analysis cancels the one in flight, whose callback never fires.
+     */
+    UFUNCTION(BlueprintCallable, Category="Contracts")
+    int32 AnalyzeDealRisk(const FArtistDealTerms& Deal, const FArtistData& ArtistInfo, int32 Seed, const FOnDealRiskAnalyzed& OnComplete);
+
     UFUNCTION(BlueprintCallable, Category="Contracts")
     void ExpireContract(const FString& ArtistId);
 
     const FArtistContract* GetContractByArtistId(const FString& ArtistId) const;
 
-    void GetSignedArtistData(TArray<FArtistData>& OutArtistData) const;
+    /** Shared, immutable view of the signed roster. Only rebuilt after the roster changes. */
+    FSignedRosterSnapshotRef GetSignedRosterSnapshot() const;
+
+    uint32 GetRosterVersion() const { return RosterVersion; }
 
     const FArtistContract* FindContractByArtistName(const FString& ArtistName) const;
 
@@ -54,7 +90,7 @@ public:
     TArray<FArtistContract> ExpiredContracts;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Contracts")
-    FDateTime CurrentGameDate = FDateTime();
+    FGameMonth CurrentMonth = FGameMonth(0);
 
     UPROPERTY(BlueprintAssignable, Category="Contracts")
     FOnArtistSigned OnArtistSigned;
@@ -71,6 +107,59 @@ public:
     UPROPERTY(BlueprintAssignable, Category="Contracts")
     FOnArtistListChanged OnArtistListChanged;
 
+    UPROPERTY(EditAnywhere, Category="Contracts|Risk", meta=(ClampMin="64", ClampMax="65536"))
+    int32 RiskSimulationCount = 4096;
+
+    UPROPERTY(EditAnywhere, Category="Contracts|Risk", meta=(ClampMin="0.0", ClampMax="1.0"))
+    float RiskPerformanceVolatility = 0.25f;
+
+    UPROPERTY(EditAnywhere, Category="Contracts|Risk", meta=(ClampMin="0.0"))
+    float RiskRevenuePerPopularityPoint = 150.f;
+
 protected:
     int32 CalculateContractDurationMonths(const FArtistDealTerms& Deal) const;
+
+    /** Bumps the roster version and notifies OnArtistListChanged listeners. */
+    void NotifyRosterChanged();
+
+    /** Month the contract runs out, by end date or by length, whichever comes first. */
+    FGameMonth GetContractExpiryMonth(const FArtistContract& Contract) const;
+
+    void ScheduleContractExpiry(const FArtistContract& Contract);
+
+    /** Calendar callback for a contract reaching its expiry month. */
+    void HandleContractEnded(const FGameMonth& DueMonth, FString ArtistId);
+
+    void HandleMonthBegun(const FGameMonth& PendingMonth);
+
+    /** Writes SimContractResults into ActiveContracts and notifies listeners. */
+    void ApplyContractResults();
+
+    /** Hands a contract event to the news generator for this month's batch. */
+    void SubmitContractNews(ENewsCandidateKind Kind, const FArtistContract& Contract, float Amount, float Magnitude) const;
+
+private:
+    FDelegateHandle MonthStageHandle;
+    FDelegateHandle PublishStageHandle;
+    FDelegateHandle MonthBegunHandle;
+
+    /** Simulated state of each active contract, indexed like ActiveContracts. Owned by the worker while Commands is held. */
+    TArray<FContractSimState> SimContracts;
+
+    /** What the last step produced for each contract, indexed like ActiveContracts. */
+    TArray<FContractMonthResult> SimContractResults;
+
+    /** Signings and expiries, deferred while a month step is in flight. */
+    FSimulationCommandQueue Commands;
+
+    /** Pending calendar expiry per active contract, by artist id. */
+    TMap<FString, FCalendarEventHandle> ContractExpiryEvents;
+
+    uint32 RosterVersion = 1;
+
+    /** Lazily rebuilt in GetSignedRosterSnapshot when its version falls behind RosterVersion. */
+    mutable FSignedRosterSnapshotPtr CachedRosterSnapshot;
+
+    /** Id of the newest risk analysis; shared with workers so superseded runs can bail out early. */
+    TSharedRef<std::atomic<int32>, ESPMode::ThreadSafe> LatestRiskRequestId = MakeShared<std::atomic<int32>, ESPMode::ThreadSafe>(0);
 };
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "AuditionTypes.h"
+#include "FArtistDealTerms.h"
+#include "FContractForecast.h"
+#include "DealRiskSimulator.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/Slider.h"
@@ -82,6 +85,14 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Audition")
     FOnAuditionDecision OnPass;
 
+    /** Projection of the deal currently on the sliders. Refreshed before OnNegotiationValueChanged fires. */
+    UPROPERTY(BlueprintReadOnly, Category = "Audition")
+    FContractForecast DealForecast;
+
+    /** Monte Carlo profit bands for the deal on the sliders. Arrives asynchronously via OnDealRiskUpdated. */
+    UPROPERTY(BlueprintReadOnly, Category = "Audition")
+    FDealRiskReport DealRisk;
+
     UFUNCTION(BlueprintCallable)
     void RefreshDisplay();
 
@@ -115,6 +126,16 @@ protected:
     UFUNCTION(BlueprintImplementableEvent)
     void OnNegotiationValueChanged();
 
+    UFUNCTION(BlueprintImplementableEvent)
+    void OnDealRiskUpdated();
+
+    UFUNCTION()
+    void HandleDealRiskAnalyzed(const FDealRiskReport& Report);
+
+    FArtistDealTerms BuildDealTerms() const;
+
+    void UpdateDealForecast();
+
 private:
     bool bHasInitializedTestData = false;
 };
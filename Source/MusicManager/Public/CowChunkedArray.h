@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Array stored as fixed-size chunks shared between copies. Copying costs one reference per chunk; the first
+ * write to a chunk that another copy still references clones just that chunk.
+ *
+ * Chunk reference counts are thread safe, so copies may be handed to different workers. A single copy is not:
+ * only one thread may use a given instance at a time.
+ */
+template <typename ElementType, int32 ChunkSize = 256>
+class TCowChunkedArray
+{
+    static_assert(ChunkSize > 0, "Chunks must hold at least one element.");
+
+    using FChunk = TArray<ElementType>;
+    using FChunkRef = TSharedRef<FChunk, ESPMode::ThreadSafe>;
+
+public:
+    int32 Num() const { return NumElements; }
+    int32 NumChunks() const { return Chunks.Num(); }
+
+    const ElementType& operator[](int32 Index) const
+    {
+        checkSlow(Index >= 0 && Index < NumElements);
+        return Chunks[Index / ChunkSize].Get()[Index % ChunkSize];
+    }
+
+    ElementType& GetMutable(int32 Index)
+    {
+        checkSlow(Index >= 0 && Index < NumElements);
+        return GetMutableChunk(Index / ChunkSize)[Index % ChunkSize];
+    }
+
+    /** Elements of one chunk, cloned first if another copy shares it. */
+    TArrayView<ElementType> GetMutableChunk(int32 ChunkIndex)
+    {
+        return TArrayView<ElementType>(MakeChunkUnique(ChunkIndex));
+    }
+
+    TArrayView<const ElementType> GetChunk(int32 ChunkIndex) const
+    {
+        return TArrayView<const ElementType>(Chunks[ChunkIndex].Get());
+    }
+
+    int32 Add(const ElementType& Element)
+    {
+        if (NumElements % ChunkSize == 0)
+        {
+            FChunkRef NewChunk = MakeShared<FChunk, ESPMode::ThreadSafe>();
+            NewChunk->Reserve(ChunkSize);
+            Chunks.Add(MoveTemp(NewChunk));
+        }
+
+        MakeChunkUnique(Chunks.Num() - 1).Add(Element);
+        return NumElements++;
+    }
+
+    void Reset()
+    {
+        Chunks.Reset();
+        NumElements = 0;
+    }
+
+private:
+    FChunk& MakeChunkUnique(int32 ChunkIndex)
+    {
+        FChunkRef& Chunk = Chunks[ChunkIndex];
+        if (!Chunk.IsUnique())
+        {
+            // Keeps the full chunk capacity so later appends to a cloned tail chunk do not reallocate.
+            FChunkRef Clone = MakeShared<FChunk, ESPMode::ThreadSafe>();
+            Clone->Reserve(ChunkSize);
+            Clone->Append(Chunk.Get());
+            Chunk = MoveTemp(Clone);
+        }
+        return Chunk.Get();
+    }
+
+    TArray<FChunkRef> Chunks;
+    int32 NumElements = 0;
+};
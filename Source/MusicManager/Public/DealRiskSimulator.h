@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AuditionTypes.h"
+#include "FArtistDealTerms.h"
+#include "DealRiskSimulator.generated.h"
+
+/**
+ * Percentile bands of label profit produced by a Monte Carlo run over a proposed deal.
+ */
+USTRUCT(BlueprintType)
+struct FDealRiskReport
+{
+    GENERATED_BODY()
+
+    /** Identifier returned by UArtistManagerSubsystem::AnalyzeDealRisk for the request that produced this report. */
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    int32 RequestId = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    int32 NumSimulations = 0;
+
+    /** Cumulative label profit at the end of each contract month, 10th percentile. */
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    TArray<float> CumulativeProfitP10;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    TArray<float> CumulativeProfitP50;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    TArray<float> CumulativeProfitP90;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    float NetProfitP10 = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    float NetProfitP50 = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    float NetProfitP90 = 0.f;
+
+    /** Fraction of simulations that end the contract below zero profit. */
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    float LossProbability = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Risk")
+    float ElapsedMilliseconds = 0.f;
+};
+
+/** Tunables for the Monte Carlo deal risk model. */
+struct FDealRiskSettings
+{
+    int32 NumSimulations = 4096;
+
+    int32 Seed = 0;
+
+    /** Relative spread of the artist's monthly performance around their audition score. */
+    float PerformanceVolatility = 0.25f;
+
+    /** Monthly revenue a delivered record earns per point of chart popularity, before royalties. */
+    float RevenuePerPopularityPoint = 150.f;
+};
+
+/**
+ * Runs seeded Monte Carlo simulations of a deal on top of the shared contract and song models.
+ * Each simulation draws the artist's monthly performance and the viral spikes of every record it delivers.
+ */
+class FDealRiskSimulator
+{
+public:
+    /**
+     * Blocking; fans the simulations out over worker threads with ParallelFor.
+     * ShouldCancel is polled concurrently from workers. Returns false if the run was cancelled.
+     */
+    static bool Run(const FArtistDealTerms& Deal, const FArtistData& Artist, const FDealRiskSettings& Settings,
+        FDealRiskReport& OutReport, TFunctionRef<bool()> ShouldCancel);
+};
@@ -2,101 +2,25 @@
 #pragma once
 
 #include "Subsystems/GameInstanceSubsystem.h"
-#include "TimerManager.h"
+#include "Containers/Queue.h"
+#include "MusicNewsTypes.h"
+#include "NewsStore.h"
+#include <atomic>
 #include "EventSubsystem.generated.h"
 
 class ULayout;
+class UMusicSaveGame;
 class UUserWidget;
 class UWorld;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogEventSubsystem, Log, All);
 
 
-UENUM(BlueprintType)
-enum class EMusicNewsType : uint8
-{
-    None                        UMETA(DisplayName = "None"),
-
-    // --- Artist & career ---
-    ArtistSigned                UMETA(DisplayName = "Artist Signed to Label"),
-    ArtistDropped               UMETA(DisplayName = "Artist Dropped from Label"),
-    ArtistPerformance           UMETA(DisplayName = "Live Performance"),
-    ArtistAward                 UMETA(DisplayName = "Artist Wins Award"),
-    ArtistScandal               UMETA(DisplayName = "Artist Scandal or Controversy"),
-    NewUpcomingArtistPerforming UMETA(DisplayName = "Upcoming Artist Performing"),
-
-    // --- Releases & production ---
-    RecordRelease               UMETA(DisplayName = "Record Release"),
-    MusicVideoRelease           UMETA(DisplayName = "Music Video Release"),
-    RecordingSession            UMETA(DisplayName = "Recording Session Started/Ended"),
-    ChartAchievement            UMETA(DisplayName = "Chart Achievement"),
-
-    // --- Business & industry ---
-    DealSigned                  UMETA(DisplayName = "New Business Deal"),
-    MarketingPush               UMETA(DisplayName = "Marketing Campaign Launch"),
-    Partnership                 UMETA(DisplayName = "Partnership or Collaboration"),
-    FinancialReport             UMETA(DisplayName = "Financial Report or Milestone"),
-    LabelExpansion              UMETA(DisplayName = "Label Expansion / New Office"),
-
-    // --- World & culture ---
-    FestivalAnnouncement        UMETA(DisplayName = "Festival or Event Announcement"),
-    IndustryTrend               UMETA(DisplayName = "Industry Trend"),
-    RivalLabelNews              UMETA(DisplayName = "Rival Label News"),
-    MarketShift                 UMETA(DisplayName = "Market Shift"),
-};
-
-USTRUCT(BlueprintType)
-struct FMusicNewsEvent
-{
-    GENERATED_BODY()
-
-    /** Unique ID for saving or sorting */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FGuid NewsId;
-
-    /** When this news occurs (in-game time) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FDateTime Timestamp;
-
-    /** Type/category of news */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    EMusicNewsType NewsType = EMusicNewsType::None;
-
-    /** Source of the news (artist, label, festival, etc.) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString SourceName;
-
-    /** Optional subject: album, tour, award, etc. */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString SubjectName;
-
-    /** Short headline for newsfeed */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString Headline;
-
-    /** Body text for details panel */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (MultiLine = true))
-    FString BodyText;
-
-    /** Tags for filtering/searching (e.g. "Rock", "Europe", "Scandal") */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    TArray<FString> Tags;
-
-    /** Impact on gameplay systems */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    int32 ReputationDelta = 0;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    int32 RevenueDelta = 0;
-
-    /** Optional data for UI or logic hooks */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    TMap<FString, FString> Metadata;
-};
-
-
 /**
- * Game-instance subsystem that periodically notifies a child widget on a registered layout widget.
+ * Game-instance subsystem that keeps the news history and routes posted news to the registered layout's feed.
+ *
+ * It has no tick of its own. News posted on the game thread is delivered immediately; the first news queued from
+ * other threads hands one drain to the game-thread command queue, and nothing runs while no news is coming in.
  */
 UCLASS(Config=Game)
 class UEventSubsystem : public UGameInstanceSubsystem
@@ -113,23 +37,56 @@ public:
     UFUNCTION(BlueprintCallable, Category="EventSubsystem")
     void UnregisterLayout(ULayout* InLayout);
 
+    /** The layout whose feed posted news is routed to, if one is registered. */
+    ULayout* GetLayout() const;
+
+    /**
+     * Adds a news event from any game system to the history and routes it to the registered layout's feed.
+     * Called off the game thread, the event is queued instead and the returned handle is invalid.
+     */
+    UFUNCTION(BlueprintCallable, Category="EventSubsystem")
+    FNewsHandle PostNews(const FMusicNewsEvent& Event);
+
+    /** Queues news from any thread. It is posted on the game thread at the start of the next frame. */
+    void QueueNews(FMusicNewsEvent&& Event);
+
+    /** Every news item posted so far; cards and the feed refer into it by handle. */
+    const FNewsStore& GetNewsStore() const { return NewsStore; }
+
+    /** Marks items a roundup stands for, so no feed shows them alongside it. The mark is saved with the history. */
+    void MarkNewsRolledUp(TConstArrayView<FNewsHandle> News);
+
+    void SaveState(UMusicSaveGame* SaveObject);
+    void LoadState(const UMusicSaveGame* SaveObject);
+
+    /**
+     * Decodes a history restored by LoadState. Loading only keeps the saved bytes, so a long history costs
+     * nothing until the feed is first opened or news is posted; both call this first.
+     */
+    void EnsureHistoryLoaded();
+
+    /** Full copy of a posted item, for Blueprint code that works on FMusicNewsEvent. */
+    UFUNCTION(BlueprintCallable, Category="EventSubsystem")
+    bool GetNewsEvent(FNewsHandle Handle, FMusicNewsEvent& OutEvent) const;
+
+    /** Finds posted items matching Query, newest first. Returns the total number of matches. */
+    UFUNCTION(BlueprintCallable, Category="EventSubsystem")
+    int32 QueryNews(const FNewsQuery& Query, TArray<FNewsHandle>& OutNews, int32 MaxResults = 100);
+
 
     void HandlePostWorldInit(UWorld* InWorld, const UWorld::InitializationValues IVS);
     void SendDummyNews();
     void HandleWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
-    void StartTimerForWorld(UWorld* InWorld);
-    void StopTimer();
-    void OnTimerTick();
     UUserWidget* ResolveChildWidget(ULayout& Layout);
     bool IsSameGameInstanceWorld(const UWorld& World) const;
 
     TWeakObjectPtr<UWorld> CachedWorld;
-    FTimerHandle EventTimerHandle;
     FDelegateHandle WorldInitHandle;
     FDelegateHandle WorldCleanupHandle;
 
-    UPROPERTY(EditAnywhere, Config, meta=(ClampMin="0.1", ClampMax="60.0"))
-    float TickIntervalSeconds = 5.0f;
+    /** News items kept in the history; the oldest are dropped beyond this. */
+    UPROPERTY(EditAnywhere, Config, meta=(ClampMin="16", ClampMax="65536"))
+    int32 NewsHistoryCapacity = 1024;
 
     UPROPERTY(EditAnywhere, Config)
     FName ChildWidgetName = TEXT("EventTicker");
@@ -140,4 +97,22 @@ public:
     TWeakObjectPtr<ULayout> LayoutWeak;
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TWeakObjectPtr<UUserWidget> ChildWeak;
+
+private:
+    /** Posts everything queued so far. Runs from the game-thread command queue. */
+    void DrainQueuedNews();
+
+    FNewsStore NewsStore;
+
+    /** Saved history not decoded yet; written back as-is if the game is saved before anything needed it. */
+    TArray<uint8> PendingHistory;
+    bool bHistoryPending = false;
+
+    TQueue<FMusicNewsEvent, EQueueMode::Mpsc> QueuedNews;
+
+    /**
+     * Set by the producer that finds the queue idle; that producer schedules the drain. The drain is scheduled
+     * through the command queue, so no thread but the game thread ever touches ticker state.
+     */
+    std::atomic<bool> bDrainScheduled { false };
 };
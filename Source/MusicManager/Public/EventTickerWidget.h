@@ -31,15 +31,20 @@ public:
     UPROPERTY(BlueprintAssignable, Category="News")
     FOnNewsCardClicked OnNewsCardClicked;
 
+    /** Shows a news item from the event subsystem's history. */
     UFUNCTION(BlueprintCallable, Category="News")
-    void SetNewsEvent(const FMusicNewsEvent& InEvent);
+    void SetNewsEvent(FNewsHandle InNews);
+
+    UFUNCTION(BlueprintPure, Category="News")
+    FNewsHandle GetNewsHandle() const { return NewsHandle; }
+
+    /** Full copy of the shown item. Allocates, so prefer the handle where it will do. */
+    UFUNCTION(BlueprintCallable, Category="News")
+    bool GetNewsEvent(FMusicNewsEvent& OutEvent) const;
 
     UFUNCTION(BlueprintCallable, Category="Layout")
     void SetLayoutReference(ULayout* InLayout);
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="News", meta=(ExposeOnSpawn=true))
-    FMusicNewsEvent NewsEvent;
-
 protected:
     UPROPERTY(meta=(BindWidgetOptional))
     UTextBlock* HeadlineText;
@@ -76,6 +81,10 @@ private:
 
     void HandleUpcomingArtistAudition();
 
+    const FNewsStore* GetNewsStore() const;
+
+    FNewsHandle NewsHandle;
+
     EMusicNewsType CurrentNewsType = EMusicNewsType::None;
 
     TWeakObjectPtr<ULayout> LayoutRef;
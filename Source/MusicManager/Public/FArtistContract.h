@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "AuditionTypes.h"
 #include "FArtistDealTerms.h"
+#include "GameMonth.h"
 #include "FArtistContract.generated.h"
 
 USTRUCT(BlueprintType)
@@ -20,10 +21,18 @@ struct FArtistContract
     FArtistDealTerms Terms;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Contract")
-    FDateTime StartDate = FDateTime();
+    FGameMonth StartMonth;
 
+    /** First month the contract is no longer in force: StartMonth plus the contract length. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Contract")
-    FDateTime EndDate = FDateTime();
+    FGameMonth EndMonth;
+
+    /** Saves older than EMusicSaveVersion::GameMonths kept the dates; read only by the save upgrade. */
+    UPROPERTY()
+    FDateTime StartDate_DEPRECATED;
+
+    UPROPERTY()
+    FDateTime EndDate_DEPRECATED;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Contract")
     int32 RecordsDelivered = 0;
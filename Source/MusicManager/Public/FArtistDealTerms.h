@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameMonth.h"
 #include "FArtistDealTerms.generated.h"
 
 USTRUCT(BlueprintType)
@@ -26,6 +27,7 @@ struct FArtistDealTerms
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Deal")
     bool bExclusive = false;
 
+    /** Month the contract starts; unset means the month it is signed. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Deal")
-    FDateTime ProposedStartDate = FDateTime();
+    FGameMonth ProposedStartMonth;
 };
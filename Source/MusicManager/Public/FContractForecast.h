@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FContractForecast.generated.h"
+
+/**
+ * Month-by-month projection of what a proposed deal earns and costs the label.
+ */
+USTRUCT(BlueprintType)
+struct FContractForecast
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    int32 ContractMonths = 0;
+
+    /** Gross revenue generated in each contract month. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    TArray<float> MonthlyRevenue;
+
+    /** Royalties plus upkeep paid in each contract month. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    TArray<float> MonthlyCost;
+
+    /** Royalties paid to the artist in each contract month. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    TArray<float> MonthlyRoyalty;
+
+    /** Running label profit at the end of each month, including the sign-up bonus. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    TArray<float> CumulativeProfit;
+
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    float TotalRevenue = 0.f;
+
+    /** Total cost over the contract, including the sign-up bonus. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    float TotalCost = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    float TotalRoyalty = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    float NetProfit = 0.f;
+
+    /** First zero-based month in which cumulative profit turns positive, or INDEX_NONE. */
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    int32 BreakEvenMonth = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category="Forecast")
+    int32 ProjectedRecords = 0;
+};
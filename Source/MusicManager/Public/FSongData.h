@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameMonth.h"
 #include "Sound/SoundWave.h" // REQUIRED for USTRUCT member TObjectPtr<USoundWave>
 #include "FSongData.generated.h"
 
@@ -31,9 +32,8 @@ public:
         , CurrentPopularity(0.f)
         , ChartWeeks(0)
         , SoundWave(nullptr)
-        , ReleaseYear(0)
-        , ReleaseMonth(0)
         , bIsReleased(false)
+        , ReleaseYear_DEPRECATED(0)
     {
     }
 
@@ -117,15 +117,18 @@ public:
 
     // --- Release Metadata ---
 
-    /** Calendar year when the song officially released. */
+    /** Simulation month in which the song officially released. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Release")
-    int32 ReleaseYear;
-
-    /** Calendar month when the song officially released. */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Release")
-    int32 ReleaseMonth;
+    FGameMonth ReleaseMonth;
 
     /** Flag indicating if the song has been released to the public. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Release")
     bool bIsReleased;
+
+    /**
+     * Release year from saves older than EMusicSaveVersion::GameMonths, which stored the calendar month of
+     * the release in ReleaseMonth. Read only by the save upgrade.
+     */
+    UPROPERTY()
+    int32 ReleaseYear_DEPRECATED;
 };
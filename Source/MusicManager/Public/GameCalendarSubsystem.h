@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameMonth.h"
+#include "MonthPipeline.h"
+#include "GameCalendarSubsystem.generated.h"
+
+DECLARE_DELEGATE_OneParam(FCalendarEventDelegate, const FGameMonth& /*DueMonth*/);
+
+/** Identifies a scheduled calendar event. Stays safe to use after the event fired or was cancelled. */
+struct FCalendarEventHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Reset() { *this = FCalendarEventHandle(); }
+};
+
+/**
+ * One-shot callbacks scheduled for a future month, such as a song release or the end of a contract.
+ *
+ * Events live in a hierarchical timing wheel keyed by month index: three levels of sixteen slots cover the
+ * next 4096 months, and anything further out waits in an overflow list. Scheduling and cancelling are O(1);
+ * each month only touches the slot that comes due plus, every sixteenth month, one slot cascaded down from
+ * the level above. Due events fire from a month pipeline stage at the end of the phase they were scheduled
+ * for, in the order they were scheduled.
+ */
+UCLASS()
+class MUSICMANAGER_API UGameCalendarSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Schedules Callback to run in DueMonth's Phase. The current month has already started, so an event due in
+     * it is moved to the next one and never fires in the same month's pipeline that scheduled it. An event due
+     * in an earlier month is a caller bug; it is reported and fires at the next chance instead of being dropped.
+     */
+    FCalendarEventHandle ScheduleEvent(const FGameMonth& DueMonth, EMonthPhase Phase, FCalendarEventDelegate Callback);
+
+    /** Cancels the event if it has not fired yet and resets the handle. Returns whether anything was cancelled. */
+    bool CancelEvent(FCalendarEventHandle& Handle);
+
+    bool IsScheduled(const FCalendarEventHandle& Handle) const;
+
+    /**
+     * Drops every scheduled event and moves the calendar to Month, e.g. when a save is loaded. Owners of events
+     * reschedule them afterwards; their old handles are no longer scheduled.
+     */
+    void ResetTo(const FGameMonth& Month);
+
+    int32 GetNumScheduledEvents() const { return NumScheduledEvents; }
+
+private:
+    static constexpr int32 SlotBits = 4;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 NumLevels = 3;
+    static constexpr int32 OverflowList = NumLevels * SlotsPerLevel;
+    static constexpr int32 FirstDueList = OverflowList + 1;
+    static constexpr int32 NumLists = FirstDueList + static_cast<int32>(EMonthPhase::Num);
+
+    struct FScheduledEvent
+    {
+        FCalendarEventDelegate Callback;
+        FGameMonth DueMonth;
+        EMonthPhase Phase = EMonthPhase::Songs;
+
+        /** List the event is linked into; INDEX_NONE while the slot is free. */
+        int32 List = INDEX_NONE;
+        int32 Prev = INDEX_NONE;
+
+        /** Next event in the same list, or the next free slot. */
+        int32 Next = INDEX_NONE;
+
+        /** Bumped whenever the slot is freed so stale handles stop matching. */
+        uint32 Serial = 1;
+    };
+
+    struct FEventList
+    {
+        int32 Head = INDEX_NONE;
+        int32 Tail = INDEX_NONE;
+    };
+
+    /** Month pipeline stage, registered once per phase. */
+    bool FireDueEvents(const FGameMonth& Month, int32& Cursor, double DeadlineSeconds, EMonthPhase Phase);
+
+    /** Moves the wheel to Month and gathers the events due in it into the per-phase due lists. */
+    void AdvanceTo(const FGameMonth& Month);
+
+    /** Re-links every event in List against the current base month. */
+    void Cascade(int32 List);
+
+    /** Wheel list an event due in DueMonth belongs to, relative to BaseMonth. */
+    int32 GetWheelList(const FGameMonth& DueMonth) const;
+
+    void Link(int32 EventIndex, int32 List);
+    void Unlink(int32 EventIndex);
+    void FreeEvent(int32 EventIndex);
+
+    TArray<FScheduledEvent> Events;
+    FEventList Lists[NumLists];
+
+    int32 FirstFreeEvent = INDEX_NONE;
+    int32 NumScheduledEvents = 0;
+
+    /** Month the wheel was last advanced to. Events due in it or earlier have already been gathered. */
+    FGameMonth BaseMonth;
+
+    FDelegateHandle MonthStageHandles[static_cast<int32>(EMonthPhase::Num)];
+};
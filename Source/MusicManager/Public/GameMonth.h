@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/PropertyTag.h"
+#include "GameMonth.generated.h"
+
+/**
+ * Compact calendar position used by the simulation: whole months since January 1955.
+ * Comparisons and arithmetic are plain integer operations; convert to FDateTime only for display.
+ */
+USTRUCT(BlueprintType)
+struct FGameMonth
+{
+    GENERATED_BODY()
+
+    static constexpr int32 EpochYear = 1955;
+
+    /** Months since January 1955. INDEX_NONE marks an unset month. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, Category="Time")
+    int32 Index = INDEX_NONE;
+
+    FGameMonth() = default;
+
+    explicit FGameMonth(int32 InIndex)
+        : Index(InIndex)
+    {
+    }
+
+    static FGameMonth FromYearMonth(int32 Year, int32 Month)
+    {
+        return FGameMonth((Year - EpochYear) * 12 + (Month - 1));
+    }
+
+    static FGameMonth FromDateTime(const FDateTime& Date)
+    {
+        return FromYearMonth(Date.GetYear(), Date.GetMonth());
+    }
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    /**
+     * Loads a plain int32 saved where an FGameMonth now lives, such as the calendar month FSongData kept before
+     * it stored an FGameMonth. The value is kept as is; UMusicSaveGame::UpgradeToLatest interprets it.
+     */
+    bool SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+    {
+        if (Tag.Type == NAME_IntProperty)
+        {
+            Slot << Index;
+            return true;
+        }
+        return false;
+    }
+
+    int32 GetYear() const
+    {
+        // Floor division so months before the epoch still map to the right year.
+        return EpochYear + (Index >= 0 ? Index / 12 : (Index - 11) / 12);
+    }
+
+    /** Calendar month, 1-12. */
+    int32 GetMonth() const
+    {
+        return Index - (GetYear() - EpochYear) * 12 + 1;
+    }
+
+    /** First day of the month, for display and formatting only. */
+    FDateTime ToDateTime() const
+    {
+        return FDateTime(GetYear(), GetMonth(), 1);
+    }
+
+    /** ISO-style "1964-03". */
+    FString ToString() const
+    {
+        return FString::Printf(TEXT("%04d-%02d"), GetYear(), GetMonth());
+    }
+
+    FGameMonth operator+(int32 Months) const { return FGameMonth(Index + Months); }
+    FGameMonth operator-(int32 Months) const { return FGameMonth(Index - Months); }
+    int32 operator-(const FGameMonth& Other) const { return Index - Other.Index; }
+
+    FGameMonth& operator+=(int32 Months)
+    {
+        Index += Months;
+        return *this;
+    }
+
+    bool operator==(const FGameMonth& Other) const { return Index == Other.Index; }
+    bool operator!=(const FGameMonth& Other) const { return Index != Other.Index; }
+    bool operator<(const FGameMonth& Other) const { return Index < Other.Index; }
+    bool operator<=(const FGameMonth& Other) const { return Index <= Other.Index; }
+    bool operator>(const FGameMonth& Other) const { return Index > Other.Index; }
+    bool operator>=(const FGameMonth& Other) const { return Index >= Other.Index; }
+
+    friend uint32 GetTypeHash(const FGameMonth& Month)
+    {
+        return ::GetTypeHash(Month.Index);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FGameMonth> : public TStructOpsTypeTraitsBase2<FGameMonth>
+{
+    enum
+    {
+        WithStructuredSerializeFromMismatchedTag = true,
+    };
+};
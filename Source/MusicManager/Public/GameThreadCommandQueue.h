@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include <atomic>
+
+/**
+ * Work handed to the game thread from anywhere, run at one fixed point each frame.
+ *
+ * Commands go into a lock-free multi-producer queue and are drained from the core ticker, so posting one costs
+ * a queue node rather than a task graph task. Commands are move-only functions; payloads should be moved into
+ * them rather than copied. Commands bound to a UObject are skipped if it is gone by the time they run, and a
+ * keyed command is dropped while an identical one for the same object is still waiting, so a burst of refresh
+ * requests leads to one refresh.
+ *
+ * Code already on the game thread should just do the work; this is for hops from other threads and for work
+ * that has to wait until the current call stack has unwound.
+ */
+class MUSICMANAGER_API FGameThreadCommandQueue
+{
+public:
+    static FGameThreadCommandQueue& Get();
+
+    /** Queues Command for the next drain. Any thread. */
+    void Enqueue(TUniqueFunction<void()>&& Command)
+    {
+        EnqueueCommand(FCommand{ MoveTemp(Command), FCommandKey() });
+    }
+
+    /** Queues Command to run on Object, if Object still exists when the queue is drained. Any thread. */
+    template <typename ObjectType, typename FuncType>
+    void Enqueue(ObjectType* Object, FuncType&& Command)
+    {
+        Enqueue(MakeBoundCommand(Object, Forward<FuncType>(Command)));
+    }
+
+    /** Like the Enqueue above, but does nothing if a command with the same Object and Key is already waiting. */
+    template <typename ObjectType, typename FuncType>
+    void EnqueueUnique(ObjectType* Object, FName Key, FuncType&& Command)
+    {
+        const FCommandKey CommandKey{ FObjectKey(Object), Key };
+        if (TryClaimKey(CommandKey))
+        {
+            EnqueueCommand(FCommand{ MakeBoundCommand(Object, Forward<FuncType>(Command)), CommandKey });
+        }
+    }
+
+    /** Runs the commands queued so far. Commands they queue wait for the next drain. Game thread only. */
+    void Drain();
+
+private:
+    FGameThreadCommandQueue();
+
+    struct FCommandKey
+    {
+        FObjectKey Object;
+        FName Name;
+
+        bool IsSet() const { return !Name.IsNone(); }
+        bool operator==(const FCommandKey& Other) const { return Object == Other.Object && Name == Other.Name; }
+        friend uint32 GetTypeHash(const FCommandKey& Key) { return HashCombine(GetTypeHash(Key.Object), GetTypeHash(Key.Name)); }
+    };
+
+    struct FCommand
+    {
+        TUniqueFunction<void()> Function;
+        FCommandKey Key;
+    };
+
+    template <typename ObjectType, typename FuncType>
+    static TUniqueFunction<void()> MakeBoundCommand(ObjectType* Object, FuncType&& Command)
+    {
+        return [WeakObject = TWeakObjectPtr<ObjectType>(Object), Command = Forward<FuncType>(Command)]() mutable
+        {
+            if (ObjectType* StrongObject = WeakObject.Get())
+            {
+                Command(*StrongObject);
+            }
+        };
+    }
+
+    void EnqueueCommand(FCommand&& Command);
+    bool TryClaimKey(const FCommandKey& Key);
+    bool Tick(float DeltaTime);
+
+    TQueue<FCommand, EQueueMode::Mpsc> Commands;
+    std::atomic<int32> NumQueued { 0 };
+
+    /** Keys of waiting keyed commands. Only keyed commands take the lock. */
+    FCriticalSection PendingKeysLock;
+    TSet<FCommandKey> PendingKeys;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -3,16 +3,38 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "TimerManager.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "GameMonth.h"
+#include "MonthPipeline.h"
+#include "MonthProfiler.h"
 #include "GameTimeSubsystem.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMonthAdvanced, const FDateTime&, NewDate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMonthAdvanced, const FGameMonth&, NewMonth);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMonthBegun, const FGameMonth& /*PendingMonth*/);
 
 class UMusicSaveGame;
 
+/** How quickly simulated months pass while time is running. */
+UENUM(BlueprintType)
+enum class EGameTimeSpeed : uint8
+{
+    Normal UMETA(DisplayName="1x"),
+    Fast UMETA(DisplayName="2x"),
+    Faster UMETA(DisplayName="4x"),
+    /** As many months per frame as fit in the frame budget. */
+    Max UMETA(DisplayName="Max")
+};
+
 /**
  * Centralized time simulation subsystem that controls the passage of in-game months.
+ *
+ * A month runs as a pipeline of registered stages grouped into phases (Songs, Contracts, Market, News, UI).
+ * Game-thread stages run in a fixed order and are spread over as many frames as the slice budget requires;
+ * worker stages run on the task graph alongside them once their phase is ready. CurrentMonth and
+ * OnMonthAdvanced only move once every stage has finished, so displays never show a half-simulated month.
  */
-UCLASS()
+UCLASS(Config=Game)
 class UGameTimeSubsystem : public UGameInstanceSubsystem
 {
     GENERATED_BODY()
@@ -24,7 +46,7 @@ public:
     virtual void Deinitialize() override;
 
     /**
-     * Manually advance the simulation by one month.
+     * Manually advance the simulation by one month, running every stage to completion before returning.
      */
     UFUNCTION(BlueprintCallable, Category="Time")
     void AdvanceMonth();
@@ -36,37 +58,189 @@ public:
     void PauseTime(bool bPause);
 
     /**
-     * Returns the current simulated date for UI display or logic.
+     * Change how quickly months pass. Takes effect immediately if time is running, otherwise on resume.
+     */
+    UFUNCTION(BlueprintCallable, Category="Time")
+    void SetTimeSpeed(EGameTimeSpeed NewSpeed);
+
+    UFUNCTION(BlueprintPure, Category="Time")
+    EGameTimeSpeed GetTimeSpeed() const { return TimeSpeed; }
+
+    UFUNCTION(BlueprintPure, Category="Time")
+    bool IsTimeRunning() const { return bIsTimeRunning; }
+
+    /**
+     * Returns the current simulated month. Use this for all simulation logic.
+     */
+    UFUNCTION(BlueprintPure, Category="Time")
+    FGameMonth GetCurrentMonth() const { return CurrentMonth; }
+
+    /**
+     * Returns the first day of the current month for UI display and formatting.
      */
     UFUNCTION(BlueprintPure, Category="Time")
-    FDateTime GetCurrentGameDate() const { return CurrentGameDate; }
+    FDateTime GetCurrentGameDate() const { return CurrentMonth.ToDateTime(); }
+
+    /** First simulated month, January 1955. */
+    static FGameMonth GetFirstMonth() { return FGameMonth(0); }
+
+    /** Last simulated month, December 2026. */
+    static FGameMonth GetLastMonth() { return FGameMonth::FromYearMonth(2026, 12); }
+
+    /**
+     * Adds a stage to a phase of the month pipeline. Game-thread stages within a phase run by ascending
+     * OrderInPhase, then in registration order, alongside the phase's worker stages unless registered as
+     * GameThreadAfterWorkers. A stage registered while a month is in progress first runs the following month.
+     */
+    FDelegateHandle RegisterMonthStage(EMonthPhase Phase, FName StageName, FMonthStageDelegate Work,
+        EMonthStageThread Thread = EMonthStageThread::GameThread, int32 OrderInPhase = 0);
+
+    /** Removes a stage, waiting for it first if it is running on a worker. */
+    void UnregisterMonthStage(FDelegateHandle StageHandle);
+
+    /** True while a month's stages are still being worked through. */
+    bool IsMonthInProgress() const { return PendingMonth.IsValid(); }
+
+    /** Finishes the month in progress, if any, within the current frame. */
+    void FlushPendingMonth();
+
+    /** Per-stage timings, entity counts and memory deltas of recent months. */
+    const FMonthProfiler& GetMonthProfiler() const { return MonthProfiler; }
 
     void SaveState(class UMusicSaveGame* SaveObject);
     void LoadState(const class UMusicSaveGame* SaveObject);
 
     /**
-     * Fired each time the subsystem successfully advances one month.
+     * Fired each time the subsystem successfully advances one month, after every stage has finished.
+     * Intended for Blueprint listeners; native systems register a month stage instead.
      */
     UPROPERTY(BlueprintAssignable, Category="Time")
     FOnMonthAdvanced OnMonthAdvanced;
 
+    /**
+     * Fired on the game thread as a month starts, before any of its stages run. Systems whose state is stepped
+     * by a worker stage use it to start deferring commands against that state.
+     */
+    FOnMonthBegun OnMonthBegun;
+
 protected:
     void StartTimer();
     void StopTimer();
 
     bool HasSimulationEnded() const;
 
-    /** Current simulated date. Always normalized to the first day of the month. */
+    /** Fixed-speed timer callback. */
+    void HandleTimerElapsed();
+
+    /** Per-frame driver for sliced months and max speed. */
+    bool Tick(float DeltaTime);
+    void TickMaxSpeed(float DeltaTime);
+
+    /** Starts the next month's pipeline. Returns false once the simulation has ended. */
+    bool BeginMonth();
+
+    /**
+     * Starts ready phases and works through game-thread stages until the month is done or past the deadline.
+     * With no deadline it also waits for worker stages. Returns true once the month committed.
+     */
+    bool RunMonthStages(double DeadlineSeconds);
+
+    /** Starts every phase whose dependencies are complete and returns the bits of the completed phases. */
+    uint32 StartReadyPhases();
+
+    bool IsPhaseComplete(EMonthPhase Phase) const;
+
+    /** Whether every worker stage of Phase has finished and been collected by StartReadyPhases. */
+    bool AreWorkerStagesDone(EMonthPhase Phase) const;
+
+    /** Blocks until every worker stage in flight has finished. */
+    void WaitForWorkerStages();
+
+    void CommitMonth();
+
+    float GetMonthIntervalSeconds() const;
+
+    /** Real seconds per month at 1x. */
+    UPROPERTY(EditAnywhere, Config, Category="Time", meta=(ClampMin="0.1"))
+    float NormalMonthSeconds = 2.f;
+
+    /** Wall time max speed may spend advancing months in one frame. */
+    UPROPERTY(EditAnywhere, Config, Category="Time", meta=(ClampMin="1.0"))
+    float MaxSpeedFrameBudgetMilliseconds = 8.f;
+
+    /** Wall time a month in progress may take per frame at the fixed speeds. */
+    UPROPERTY(EditAnywhere, Config, Category="Time", meta=(ClampMin="0.5"))
+    float MonthSliceBudgetMilliseconds = 4.f;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Time")
-    FDateTime CurrentGameDate;
+    EGameTimeSpeed TimeSpeed = EGameTimeSpeed::Normal;
+
+    /** Current simulated month. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Time")
+    FGameMonth CurrentMonth;
 
     /** Whether the automatic timer is actively advancing months. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Time")
     bool bIsTimeRunning;
 
-    /** Internal repeating timer that fires once every ten real seconds. */
+    /** Internal repeating timer used at the fixed speeds. */
     FTimerHandle TimeAdvanceHandle;
 
+    /** Core ticker registration that drives the month pipeline every frame. */
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    /** Smoothed wall time of one month step at max speed. */
+    double AverageMonthSeconds = 0.0;
+
+    /**
+     * Frame time still owed after a month step overran the frame budget. Max speed skips frames until it is
+     * repaid, so expensive months slow the simulation down instead of the frame rate.
+     */
+    double MaxSpeedThrottleSeconds = 0.0;
+
     /** True after the timeline surpasses the year 2026, preventing further advancement. */
     bool bHasReachedSimulationEnd;
+
+private:
+    /** What a worker stage reports back to the game thread. */
+    struct FWorkerStageRun
+    {
+        double Seconds = 0.0;
+        int32 Entities = 0;
+    };
+
+    struct FMonthStage
+    {
+        FName Name;
+
+        /** Insights event name, built once at registration. */
+        FString TraceName;
+
+        EMonthPhase Phase = EMonthPhase::Songs;
+        int32 OrderInPhase = 0;
+        EMonthStageThread Thread = EMonthStageThread::GameThread;
+        FMonthStageDelegate Work;
+
+        // Progress through the month in progress.
+        int32 Cursor = 0;
+        bool bDone = true;
+        UE::Tasks::TTask<FWorkerStageRun> Task;
+    };
+
+    /** Sorted by phase, then by order in phase, then by registration. */
+    TArray<FMonthStage> MonthStages;
+
+    /** Month being simulated; unset when no month is in progress. */
+    FGameMonth PendingMonth;
+
+    /** Bit per EMonthPhase that has been started for the month in progress. */
+    uint32 StartedPhases = 0;
+
+    /** Bit per EMonthPhase whose completion has been reported to the profiler. */
+    uint32 ProfiledPhases = 0;
+
+    FMonthProfiler MonthProfiler;
+
+    /** The timer fired while a month was still in progress; start the next one as soon as it commits. */
+    bool bMonthQueued = false;
 };
@@ -6,6 +6,9 @@
 #include "ContractWidget.h"
 #include "EventTickerWidget.h"
 #include "AuditionTypes.h"
+#include "SignedRosterSnapshot.h"
+#include "NewsTickerScheduler.h"
+#include "Containers/Ticker.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include "Layout.generated.h"
 
@@ -15,6 +18,19 @@ class UAuditionWidget;
 class UUIManagerSubsystem;
 class USignedArtistPanelWidget;
 
+/** Running totals of what a layout's news ticker has put into the feed. */
+struct FNewsTickerTotals
+{
+    /** Items and roundups the feed was handed. */
+    int32 NumCards = 0;
+
+    /** News items those cards stand for; a roundup counts every item it rolled up. */
+    int32 NumItems = 0;
+
+    /** Time spent handing them to the feed, roundup posting included. */
+    double FeedSeconds = 0.0;
+};
+
 /**
  * Layout widget that exposes helpers for locating child widgets by name or class.
  */
@@ -35,17 +51,29 @@ public:
     UFUNCTION(BlueprintCallable, Category="EventSubsystem")
     UUserWidget* GetChildByNameOrClass(FName WidgetName, TSubclassOf<UUserWidget> WidgetClass) const;
 
+    /**
+     * Queues posted news for the feed. Items reach it by type priority at MaxNewsCardsPerSecond at most, and a
+     * burst of one type is shown as a single roundup item.
+     */
     UFUNCTION(BlueprintCallable, Category="News")
-    void AddNewsCardToFeed(const FMusicNewsEvent& Event);
+    void AddNewsCardToFeed(FNewsHandle News);
 
     UFUNCTION(BlueprintCallable, Category="News")
     void RemoveNewsCardFromFeed(UEventTickerWidget* Card);
 
+    const FNewsTickerTotals& GetNewsTickerTotals() const { return NewsTickerTotals; }
+
+    /**
+     * While set, news goes straight into the feed as it is posted, with no rate limit and no roundups. For
+     * measuring the feed itself, as the feed throughput automation test does.
+     */
+    void SetNewsTickerBypassed(bool bBypass) { bNewsTickerBypassed = bBypass; }
+
     /** Raised when any card in the feed is clicked */
     UPROPERTY(BlueprintAssignable, Category="News")
     FOnNewsCardSelected OnNewsCardSelected;
 
-    /** Called when a ticker widget is created and added to the feed */
+    /** Called when the feed takes a ticker widget into view */
     UFUNCTION(BlueprintCallable, Category="News")
     void BindTickerEvents(UEventTickerWidget* NewTicker);
 
@@ -62,6 +90,9 @@ public:
     UFUNCTION(BlueprintCallable, Category="Artist")
     void RefreshSignedArtists(const TArray<FArtistData>& Artists);
 
+    /** Pushes a shared roster snapshot to the signed artist panel without copying it. */
+    void RefreshSignedArtistRoster(const FSignedRosterSnapshotRef& Roster);
+
     UFUNCTION(BlueprintCallable, Category="Layout")
     UAuditionWidget* GetAuditionWidget() const;
 
@@ -78,6 +109,14 @@ protected:
     UPROPERTY(meta=(BindWidget))
     USignedArtistPanelWidget* SignedArtistsPanel;
 
+    /** Most items the news ticker adds to the feed per second. */
+    UPROPERTY(EditAnywhere, Category="News", meta=(ClampMin="0.1"))
+    float MaxNewsCardsPerSecond = 2.f;
+
+    /** Waiting items of one type that are rolled up into a single roundup item. */
+    UPROPERTY(EditAnywhere, Category="News", meta=(ClampMin="2"))
+    int32 NewsRoundupThreshold = 3;
+
 private:
     UFUNCTION()
     void HandleTickerClicked(UEventTickerWidget* ClickedTicker);
@@ -86,4 +125,20 @@ private:
     void HandleArtistSelected(FString ArtistId);
 
     UUIManagerSubsystem* GetUIManagerSubsystem() const;
+    UEventSubsystem* GetEventSubsystem() const;
+
+    /** Moves the next release from the scheduler into the feed. Runs from the core ticker while news waits. */
+    bool PumpNewsTicker(float DeltaTime);
+
+    /** Posts one item standing for all of Release's news; they stay in the history but not in the feed. */
+    void PostNewsRoundup(const FNewsTickerRelease& Release, UEventSubsystem& EventSubsystem);
+
+    FNewsTickerScheduler NewsScheduler;
+    FTSTicker::FDelegateHandle NewsTickerHandle;
+    FNewsTickerTotals NewsTickerTotals;
+
+    /** Set while a roundup is being posted, so it goes straight to the feed rather than back into the queue. */
+    bool bPostingNewsRoundup = false;
+
+    bool bNewsTickerBypassed = false;
 };
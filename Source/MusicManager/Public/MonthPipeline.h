@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameMonth.h"
+
+/**
+ * One resumable slice of a subscriber's month work. Cursor starts at zero each month and is kept between calls.
+ * Return true once the month's work is complete, or false to be resumed on a later frame. Each call must make
+ * some progress even if DeadlineSeconds (FPlatformTime::Seconds) has already passed. The Cursor a stage finishes
+ * with is reported by the month profiler as the number of entities it processed.
+ */
+DECLARE_DELEGATE_RetVal_ThreeParams(bool, FMonthStageDelegate, const FGameMonth& /*Month*/, int32& /*Cursor*/, double /*DeadlineSeconds*/);
+
+/**
+ * Phases of a simulated month. A phase starts once every phase it depends on has finished; phases with no
+ * dependency between them run side by side.
+ */
+enum class EMonthPhase : uint8
+{
+    /** Player song popularity and chart runs. */
+    Songs,
+    /** Player contract financials and expiries. */
+    Contracts,
+    /** The wider market, such as rival labels. */
+    Market,
+    /** News generated from what the simulation phases produced. Depends on Songs, Contracts and Market. */
+    News,
+    /** Widgets showing the new month. Depends on News. */
+    UI,
+
+    Num
+};
+
+inline const TCHAR* LexToString(EMonthPhase Phase)
+{
+    switch (Phase)
+    {
+    case EMonthPhase::Songs:
+        return TEXT("Songs");
+    case EMonthPhase::Contracts:
+        return TEXT("Contracts");
+    case EMonthPhase::Market:
+        return TEXT("Market");
+    case EMonthPhase::News:
+        return TEXT("News");
+    case EMonthPhase::UI:
+        return TEXT("UI");
+    default:
+        return TEXT("Unknown");
+    }
+}
+
+/** Where a stage runs. Worker stages run to completion in one call and must only touch their own data. */
+enum class EMonthStageThread : uint8
+{
+    GameThread,
+    Worker,
+    /** On the game thread once every worker stage of its phase has finished, so it may read their results. */
+    GameThreadAfterWorkers
+};
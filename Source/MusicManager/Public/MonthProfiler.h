@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameMonth.h"
+#include "MonthPipeline.h"
+
+/**
+ * Records what each month pipeline stage cost and keeps the last HistorySize months for a rolling summary.
+ *
+ * Timings and entity counts are always recorded. Working-set deltas and the on-screen summary are opt-in through
+ * the mm.MonthProfiler console variable, since sampling process memory is not free. The working set is a
+ * process-wide figure: it shows a stage growing memory, not how many allocations it made, and other threads'
+ * work lands in it too. Use LLM or Insights memory tracing for allocation counts.
+ *
+ * Committed months are swapped into a fixed ring, so recording a month does not allocate once every slot's
+ * stage array has grown to fit.
+ */
+class MUSICMANAGER_API FMonthProfiler
+{
+public:
+    static constexpr int32 HistorySize = 32;
+
+    /** One stage's cost for one month, summed over every slice it took. */
+    struct FStageSample
+    {
+        FName StageName;
+        EMonthPhase Phase = EMonthPhase::Songs;
+        double Milliseconds = 0.0;
+        int32 Slices = 0;
+        int32 Entities = 0;
+        int64 WorkingSetDeltaBytes = 0;
+    };
+
+    struct FMonthSample
+    {
+        FGameMonth Month;
+
+        /** Wall time from the start of the month until each phase finished. */
+        double PhaseMilliseconds[static_cast<int32>(EMonthPhase::Num)] = {};
+
+        /** Wall time from the start of the month until it committed, including frames spent waiting. */
+        double TotalMilliseconds = 0.0;
+
+        /** Frames the month was spread over. */
+        int32 Frames = 0;
+
+        TArray<FStageSample> Stages;
+    };
+
+    static bool IsWorkingSetTrackingEnabled();
+    static bool IsOnScreenSummaryEnabled();
+
+    void BeginMonth(const FGameMonth& Month);
+    void RecordFrame();
+    void RecordSlice(FName StageName, EMonthPhase Phase, double Seconds, int64 WorkingSetDeltaBytes);
+    void RecordStageDone(FName StageName, EMonthPhase Phase, int32 Entities);
+    void RecordPhaseDone(EMonthPhase Phase);
+    void EndMonth();
+
+    /** Most recently committed month, or null before the first one. */
+    const FMonthSample* GetLastMonth() const;
+
+    /** Per-stage averages and peaks over the recorded history, one line per stage. */
+    FString BuildSummary() const;
+
+private:
+    FStageSample& FindOrAddStage(FName StageName, EMonthPhase Phase);
+
+    FMonthSample Current;
+    double MonthStartSeconds = 0.0;
+
+    /** Ring buffer of committed months; the first NumRecorded slots are in use. */
+    FMonthSample History[HistorySize];
+    int32 NumRecorded = 0;
+    int32 NextHistoryIndex = 0;
+};
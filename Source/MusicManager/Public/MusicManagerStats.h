@@ -0,0 +1,7 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/** Simulation costs; view with "stat MusicSimulation". */
+DECLARE_STATS_GROUP(TEXT("Music Simulation"), STATGROUP_MusicSimulation, STATCAT_Advanced);
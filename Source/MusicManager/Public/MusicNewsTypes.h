@@ -0,0 +1,177 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.generated.h"
+
+UENUM(BlueprintType)
+enum class EMusicNewsType : uint8
+{
+    None                        UMETA(DisplayName = "None"),
+
+    // --- Artist & career ---
+    ArtistSigned                UMETA(DisplayName = "Artist Signed to Label"),
+    ArtistDropped               UMETA(DisplayName = "Artist Dropped from Label"),
+    ArtistPerformance           UMETA(DisplayName = "Live Performance"),
+    ArtistAward                 UMETA(DisplayName = "Artist Wins Award"),
+    ArtistScandal               UMETA(DisplayName = "Artist Scandal or Controversy"),
+    NewUpcomingArtistPerforming UMETA(DisplayName = "Upcoming Artist Performing"),
+
+    // --- Releases & production ---
+    RecordRelease               UMETA(DisplayName = "Record Release"),
+    MusicVideoRelease           UMETA(DisplayName = "Music Video Release"),
+    RecordingSession            UMETA(DisplayName = "Recording Session Started/Ended"),
+    ChartAchievement            UMETA(DisplayName = "Chart Achievement"),
+
+    // --- Business & industry ---
+    DealSigned                  UMETA(DisplayName = "New Business Deal"),
+    MarketingPush               UMETA(DisplayName = "Marketing Campaign Launch"),
+    Partnership                 UMETA(DisplayName = "Partnership or Collaboration"),
+    FinancialReport             UMETA(DisplayName = "Financial Report or Milestone"),
+    LabelExpansion              UMETA(DisplayName = "Label Expansion / New Office"),
+
+    // --- World & culture ---
+    FestivalAnnouncement        UMETA(DisplayName = "Festival or Event Announcement"),
+    IndustryTrend               UMETA(DisplayName = "Industry Trend"),
+    RivalLabelNews              UMETA(DisplayName = "Rival Label News"),
+    MarketShift                 UMETA(DisplayName = "Market Shift"),
+};
+
+/** Localized text template for generated news; see FNewsTextTemplates. */
+UENUM(BlueprintType)
+enum class ENewsTextTemplate : uint8
+{
+    None,
+    MarketRecap,
+    ChartNumberOne,
+    ChartEntry,
+    ArtistSigned,
+    ContractExpired,
+    RecordDelivered,
+    RevenueMilestone,
+    RivalTopSingle,
+    RivalSigningSpree,
+
+    /** Several items of one NewsType shown as one; TextAmount is how many, metadata "Subjects" names some. */
+    Roundup,
+};
+
+USTRUCT(BlueprintType)
+struct FMusicNewsEvent
+{
+    GENERATED_BODY()
+
+    /** Unique ID for saving or sorting */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FGuid NewsId;
+
+    /** When this news occurs (in-game time) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FDateTime Timestamp;
+
+    /** Type/category of news */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EMusicNewsType NewsType = EMusicNewsType::None;
+
+    /** Source of the news (artist, label, festival, etc.) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString SourceName;
+
+    /** Optional subject: album, tour, award, etc. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString SubjectName;
+
+    /** Short headline for newsfeed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Headline;
+
+    /** Body text for details panel */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (MultiLine = true))
+    FString BodyText;
+
+    /** Tags for filtering/searching (e.g. "Rock", "Europe", "Scandal") */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FString> Tags;
+
+    /** Impact on gameplay systems */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 ReputationDelta = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 RevenueDelta = 0;
+
+    /** Optional data for UI or logic hooks */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TMap<FString, FString> Metadata;
+
+    /**
+     * Generated news names a template instead of filling Headline and BodyText; the text is built from it,
+     * SubjectName, SourceName, TextAmount, Timestamp and Metadata in the player's language when the item is shown.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    ENewsTextTemplate TextTemplate = ENewsTextTemplate::None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float TextAmount = 0.f;
+};
+
+/**
+ * Reference to a news item held by the news store. It is a plain sequence number, so it can be copied freely;
+ * a handle to an item the store no longer holds resolves to nothing.
+ */
+USTRUCT(BlueprintType)
+struct FNewsHandle
+{
+    GENERATED_BODY()
+
+    /** Position of the item in the order news was posted, starting at one. Zero is the invalid handle. */
+    UPROPERTY()
+    uint32 Sequence = 0;
+
+    bool IsValid() const { return Sequence != 0; }
+
+    bool operator==(const FNewsHandle& Other) const { return Sequence == Other.Sequence; }
+    bool operator!=(const FNewsHandle& Other) const { return Sequence != Other.Sequence; }
+
+    friend uint32 GetTypeHash(const FNewsHandle& Handle) { return ::GetTypeHash(Handle.Sequence); }
+};
+
+/**
+ * Filter over the news history. Clauses are combined with AND; the types and sources listed within a clause
+ * are alternatives. An empty clause matches everything, so "Rock AND Scandal since 1965" is RequiredTags
+ * {Rock, Scandal} with Since set to 1965.
+ */
+USTRUCT(BlueprintType)
+struct FNewsQuery
+{
+    GENERATED_BODY()
+
+    /** Tags an item must all carry. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FName> RequiredTags;
+
+    /** Tags an item must not carry. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FName> ExcludedTags;
+
+    /** Types an item may have. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<EMusicNewsType> NewsTypes;
+
+    /** Sources an item may come from. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FName> Sources;
+
+    /** Earliest in-game time an item may have, inclusive. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FDateTime Since = FDateTime::MinValue();
+
+    /** Latest in-game time an item may have, inclusive. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FDateTime Until = FDateTime::MaxValue();
+
+    bool IsEmpty() const
+    {
+        return RequiredTags.IsEmpty() && ExcludedTags.IsEmpty() && NewsTypes.IsEmpty() && Sources.IsEmpty()
+            && Since == FDateTime::MinValue() && Until == FDateTime::MaxValue();
+    }
+};
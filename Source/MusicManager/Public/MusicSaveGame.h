@@ -4,6 +4,7 @@
 #include "GameFramework/SaveGame.h"
 #include "FArtistContract.h"
 #include "FSongData.h"
+#include "GameMonth.h"
 #include "MusicSaveGame.generated.h"
 
 USTRUCT()
@@ -21,12 +22,35 @@ struct FSavedSong
     FSongData Data;
 };
 
+/** Layout versions of UMusicSaveGame. */
+enum class EMusicSaveVersion : int32
+{
+    /** Saves from before versioning: dates as FDateTime, song releases as calendar year and month. */
+    Initial = 0,
+
+    /** Simulation dates are FGameMonths. */
+    GameMonths,
+
+    /** Each campaign has its own seed for viral rolls. */
+    CampaignSeed,
+
+    LatestPlusOne,
+    Latest = LatestPlusOne - 1
+};
+
 UCLASS()
 class MUSICMANAGER_API UMusicSaveGame : public USaveGame
 {
     GENERATED_BODY()
 
 public:
+    /** Converts data from an older save to the current layout. Loading calls this before any LoadState. */
+    void UpgradeToLatest();
+
+    /** EMusicSaveVersion the save was written with. Older saves lack the property and so load as Initial. */
+    UPROPERTY(SaveGame)
+    int32 SaveVersion = static_cast<int32>(EMusicSaveVersion::Initial);
+
     UPROPERTY(SaveGame)
     TArray<FSavedSong> SavedSongs;
 
@@ -34,8 +58,19 @@ public:
     TArray<FArtistContract> SavedContracts;
 
     UPROPERTY(SaveGame)
-    FDateTime SavedGameDate;
+    FGameMonth SavedMonth;
+
+    UPROPERTY()
+    FDateTime SavedGameDate_DEPRECATED;
 
     UPROPERTY(SaveGame)
     int32 PlayerMoney = 0;
+
+    /** Seed of the campaign's random streams, see USongManagerSubsystem::GetCampaignSeed. */
+    UPROPERTY(SaveGame)
+    int32 CampaignSeed = 0;
+
+    /** News history in the compact format written by FNewsStore::SaveHistory. */
+    UPROPERTY(SaveGame)
+    TArray<uint8> SavedNewsHistory;
 };
@@ -2,8 +2,10 @@
 #pragma once
 
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/UserWidgetPool.h"
 #include "EventSubsystem.h"
 #include "GameTimeSubsystem.h"
+#include "NewsFeedOrder.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include "NewsFeedList.generated.h"
 
@@ -12,8 +14,33 @@ class UEventTickerWidget;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogNewsFeedList, Log, All);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewsFeedCardAcquired, UEventTickerWidget*, Card);
+
+/** How the unpinned part of the news feed is sorted. */
+UENUM(BlueprintType)
+enum class ENewsFeedSortMode : uint8
+{
+    Recency     UMETA(DisplayName = "Newest First"),
+    Priority    UMETA(DisplayName = "Most Important First"),
+};
+
 /**
- * News feed list widget that manages event ticker cards safely.
+ * News feed list that shows a window over the event subsystem's news history.
+ *
+ * At most VisibleCardCount ticker cards are in the feed. New news and scrolling re-bind them to other items
+ * instead of adding widgets, so the feed's layout cost stays the same however long the campaign runs. Pinned
+ * items come first, most recently pinned on top, then the rest of the history by SortMode.
+ *
+ * The ordering lives in FNewsFeedOrder indexes, one per sort mode, kept in step with the history as items are
+ * posted and evicted. Pinning, removing and re-sorting are O(log n) updates to those indexes; only the cards
+ * whose item changed are re-bound.
+ *
+ * A filter narrows the feed to the items matching an FNewsQuery, answered by the news store's index. The
+ * matches are only looked up again when the history or the filter changes, not when the feed scrolls.
+ *
+ * Cards come from a pool that is filled when the feed is constructed. Cards the window no longer needs go back
+ * to it and are re-bound with SetNewsEvent when needed again, so a feed that empties and refills never
+ * constructs or garbage-collects cards.
  */
 UCLASS(BlueprintType, Blueprintable)
 class UNewsFeedList : public UUserWidget
@@ -25,28 +52,144 @@ public:
 
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
+    /**
+     * Shows newly posted news. Items posted after the feed was constructed only appear once passed here.
+     * Returns the card now showing it, or null if it is scrolled out of view.
+     */
     UFUNCTION(BlueprintCallable, Category="News")
-    UEventTickerWidget* AddNewsCard(const FMusicNewsEvent& Event);
+    UEventTickerWidget* AddNewsCard(FNewsHandle News);
 
+    /** Takes the item shown on Card out of the feed. It stays in the news history. */
     UFUNCTION(BlueprintCallable, Category="News")
     bool RemoveNewsCard(UEventTickerWidget* Card);
 
+    /** Pins the item shown on Card to the top of the feed and scrolls up to it. */
     UFUNCTION(BlueprintCallable, Category="News")
     bool MoveNewsCardToTop(UEventTickerWidget* Card);
 
-    /** Responds to the centralized time system whenever a new month begins. */
-    UFUNCTION()
-    void HandleMonthAdvanced(const FDateTime& NewDate);
+    /** Scrolls the feed by Delta items; positive values move towards older news. */
+    UFUNCTION(BlueprintCallable, Category="News")
+    void ScrollFeed(int32 Delta);
+
+    UFUNCTION(BlueprintPure, Category="News")
+    int32 GetNumFeedItems() const;
+
+    UFUNCTION(BlueprintCallable, Category="News")
+    void SetSortMode(ENewsFeedSortMode InSortMode);
+
+    UFUNCTION(BlueprintPure, Category="News")
+    ENewsFeedSortMode GetSortMode() const { return SortMode; }
+
+    /** Shows only the items matching Query, e.g. from the news screen's filter chips. */
+    UFUNCTION(BlueprintCallable, Category="News")
+    void SetFilter(const FNewsQuery& Query);
+
+    UFUNCTION(BlueprintCallable, Category="News")
+    void ClearFilter();
+
+    UFUNCTION(BlueprintPure, Category="News")
+    bool IsFiltered() const { return bFiltered; }
+
+    /** Cards currently in the feed, top to bottom. */
+    const TArray<TObjectPtr<UEventTickerWidget>>& GetCards() const { return Cards; }
+
+    /** Raised whenever a card is taken from the pool into the feed, so its owner can bind to it. */
+    UPROPERTY(BlueprintAssignable, Category="News")
+    FOnNewsFeedCardAcquired OnCardAcquired;
+
+    /** UI phase stage of the month pipeline; runs once the month's simulation and news are done. */
+    bool HandleMonthAdvanced(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
 
 protected:
+    virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
+
     UPROPERTY(meta=(BindWidget))
     UVerticalBox* FeedContainer;
 
     UPROPERTY(EditDefaultsOnly, Category="News")
     TSubclassOf<class UEventTickerWidget> EventTickerWidgetClass;
 
+    /** Number of cards the feed shows at once. */
+    UPROPERTY(EditAnywhere, Category="News", meta=(ClampMin="1", ClampMax="64"))
+    int32 VisibleCardCount = 8;
+
+    UPROPERTY(EditAnywhere, Category="News")
+    ENewsFeedSortMode SortMode = ENewsFeedSortMode::Recency;
+
 private:
+    /** Where the feed has placed an item it tracks. */
+    struct FFeedEntry
+    {
+        int32 Priority = 0;
+
+        /** Order in which the item was pinned, or zero if it is not pinned. */
+        int32 PinStamp = 0;
+    };
+
+    static int32 GetFeedPriority(const FNewsRecord& Record);
+
+    FNewsFeedKey MakeKey(uint32 Sequence, const FFeedEntry& Entry, ENewsFeedSortMode Mode) const;
+    const FNewsFeedOrder& GetActiveOrder() const;
+    void AddToOrders(uint32 Sequence, const FFeedEntry& Entry);
+    void RemoveFromOrders(uint32 Sequence, const FFeedEntry& Entry);
+
+    /** Drops items the history has evicted; on the first sync, also adds the history that is already there. */
+    void SyncWithNewsStore(const FNewsStore& Store);
+
+    /** Adds a history item to the orders, keeping the window on the same items if it lands above it. */
+    void TrackNews(uint32 Sequence, const FNewsRecord& Record);
+
+    /** Looks the filter's matches up again and puts them in feed order. */
+    void UpdateFilteredNews(const FNewsStore& Store);
+
+    /** Re-binds the cards to the items in the current window, taking cards from or returning them to the pool. */
+    void RefreshVisibleCards();
+
+    /** Creates cards up to VisibleCardCount ahead of time and leaves them in the pool. */
+    void PrewarmCards();
+
+    UEventTickerWidget* AcquireCard();
+    void ReleaseCard(UEventTickerWidget* Card);
+
+    const FNewsStore* GetNewsStore() const;
+
+    FDelegateHandle MonthStageHandle;
+
     /** Cached pointer to the time subsystem so we can safely unsubscribe on teardown. */
     TWeakObjectPtr<UGameTimeSubsystem> TimeSubsystemWeak;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UEventTickerWidget>> Cards;
+
+    UPROPERTY(Transient)
+    FUserWidgetPool CardPool;
+
+    FNewsFeedOrder RecencyOrder;
+    FNewsFeedOrder PriorityOrder;
+
+    /** Items in the orders by sequence. Removed items are dropped from here and from the orders. */
+    TMap<uint32, FFeedEntry> Entries;
+
+    /** Range of history sequences the feed has already seen, as [FirstTracked, NextUntracked). */
+    uint32 FirstTracked = 1;
+    uint32 NextUntracked = 1;
+
+    /** Whether the history present at construction has been added yet. */
+    bool bHasSynced = false;
+
+    int32 NextPinStamp = 1;
+
+    FNewsQuery Filter;
+    bool bFiltered = false;
+
+    /** Set when the history, the filter or the order changes, so the matches need looking up again. */
+    bool bFilterDirty = false;
+
+    /** Matches of the filter in feed order; only used while filtered. */
+    TArray<FNewsHandle> FilteredNews;
+
+    /** Feed items above the first card. */
+    int32 ScrollOffset = 0;
 };
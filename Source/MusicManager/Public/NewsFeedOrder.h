@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.h"
+
+/** Where an item sorts in a news feed. Lower keys come first. */
+struct FNewsFeedKey
+{
+    /** Zero for pinned items, one for the rest. */
+    uint8 Tier = 1;
+
+    /** Higher ranks come first within a tier: the pin stamp for pinned items, the priority for the rest. */
+    int32 Rank = 0;
+
+    /** Newer items come first among equal ranks. */
+    uint32 Sequence = 0;
+
+    bool operator<(const FNewsFeedKey& Other) const
+    {
+        if (Tier != Other.Tier)
+        {
+            return Tier < Other.Tier;
+        }
+        if (Rank != Other.Rank)
+        {
+            return Rank > Other.Rank;
+        }
+        return Sequence > Other.Sequence;
+    }
+
+    bool operator==(const FNewsFeedKey& Other) const
+    {
+        return Tier == Other.Tier && Rank == Other.Rank && Sequence == Other.Sequence;
+    }
+};
+
+/**
+ * Ordered set of feed items that can also be indexed by position.
+ *
+ * A treap whose nodes track their subtree size, so adding, removing and finding the item at a position are all
+ * O(log n). The feed keeps one per ordering and reads only the positions it shows, so pinning an item or
+ * switching how the feed is sorted costs the same whether the history holds ten items or ten thousand.
+ *
+ * Nodes live in one array linked by index and freed nodes are reused, so steady-state use does not allocate.
+ */
+class MUSICMANAGER_API FNewsFeedOrder
+{
+public:
+    void Add(const FNewsFeedKey& Key);
+
+    /** Returns false if the key was not in the order. */
+    bool Remove(const FNewsFeedKey& Key);
+
+    /** Handle of the item at Position, or an invalid handle if Position is out of range. */
+    FNewsHandle GetAt(int32 Position) const;
+
+    /** Number of items that order before Key, which is Key's position if it is in the order. */
+    int32 GetPosition(const FNewsFeedKey& Key) const;
+
+    int32 Num() const { return Root == INDEX_NONE ? 0 : Nodes[Root].Size; }
+
+    void Reset();
+
+private:
+    struct FNode
+    {
+        FNewsFeedKey Key;
+        uint32 HeapPriority = 0;
+        int32 Left = INDEX_NONE;
+        int32 Right = INDEX_NONE;
+        int32 Size = 1;
+    };
+
+    int32 GetSize(int32 Node) const { return Node == INDEX_NONE ? 0 : Nodes[Node].Size; }
+    void UpdateSize(int32 Node);
+
+    /** Splits Node into keys ordered before Key and the rest. */
+    void Split(int32 Node, const FNewsFeedKey& Key, int32& OutLeft, int32& OutRight);
+
+    /** Joins two treaps where every key in Left orders before every key in Right. */
+    int32 Merge(int32 Left, int32 Right);
+
+    TArray<FNode> Nodes;
+    TArray<int32> FreeNodes;
+    int32 Root = INDEX_NONE;
+};
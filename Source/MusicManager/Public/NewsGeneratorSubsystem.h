@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameMonth.h"
+#include "NewsGeneratorSubsystem.generated.h"
+
+/** What a news candidate reports. Decides its news type, headline and base score. */
+enum class ENewsCandidateKind : uint8
+{
+    ChartEntry,
+    NumberOne,
+    ArtistSigned,
+    ContractExpired,
+    RecordDelivered,
+    RevenueMilestone,
+};
+
+/** Something that changed in the simulation this month and might make the news. */
+struct FNewsCandidate
+{
+    ENewsCandidateKind Kind = ENewsCandidateKind::ChartEntry;
+
+    /** Song or artist id. A subject makes at most one story a month: its highest scoring candidate. */
+    FString SubjectId;
+
+    FString SubjectName;
+    FString Genre;
+
+    /** Kind-specific figure: popularity, records delivered, a revenue milestone or a sign-up bonus. */
+    float Amount = 0.f;
+
+    /** How big a deal this is among candidates of the same kind, roughly 0-100. */
+    float Magnitude = 0.f;
+};
+
+/**
+ * Turns what happened in the simulation into the month's news.
+ *
+ * Producers hand in candidates as they publish their month: chart entries and new #1s from the songs, signings,
+ * expiries, deliveries and revenue milestones from the contracts. A News phase stage that runs after those
+ * publishes scores the whole batch, keeps one candidate per subject and posts only the best MaxNewsPerMonth,
+ * so a busy month produces the same amount of news as a quiet one. Text is only built for what gets posted.
+ */
+UCLASS(Config=Game)
+class MUSICMANAGER_API UNewsGeneratorSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Queues a candidate for the next News phase. Game thread only. */
+    void AddCandidate(FNewsCandidate&& Candidate);
+
+    int32 GetNumPendingCandidates() const { return Candidates.Num(); }
+
+    /** News phase stage: scores, deduplicates and posts the top candidates, then clears the batch. */
+    bool EmitMonthNews(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+protected:
+    UPROPERTY(EditAnywhere, Config, Category="News", meta=(ClampMin="0", ClampMax="20"))
+    int32 MaxNewsPerMonth = 4;
+
+private:
+    static float ScoreCandidate(const FNewsCandidate& Candidate);
+
+    TArray<FNewsCandidate> Candidates;
+
+    // Scratch for EmitMonthNews, kept between months so the batch does not reallocate.
+    TMap<FString, int32> BestBySubject;
+    TArray<TPair<float, int32>> Ranked;
+
+    FDelegateHandle MonthStageHandle;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.h"
+
+struct FNewsRecord;
+
+/**
+ * Inverted index over the slots of an FNewsStore.
+ *
+ * Keeps one bitmap per tag, per news type and per source, with bit N set when the item in slot N matches. A
+ * query is a handful of word-wide AND/OR passes over bitmaps the size of the store's capacity, so its cost
+ * depends on the capacity and the query, never on how many items match or how the history was filtered before.
+ * The store adds and removes slots as items arrive and are evicted, so the index never needs a rebuild.
+ */
+class MUSICMANAGER_API FNewsIndex
+{
+public:
+    /** Clears the index and sizes its bitmaps for NumSlots slots. */
+    void Init(int32 NumSlots);
+
+    void Add(int32 Slot, const FNewsRecord& Record);
+    void Remove(int32 Slot, const FNewsRecord& Record);
+
+    /** Slots that hold an item. */
+    const TBitArray<>& GetLiveSlots() const { return LiveSlots; }
+
+    /** Slots whose item carries the store's tag TagIndex, or null if none ever has. */
+    const TBitArray<>* FindTagSlots(int32 TagIndex) const;
+
+    const TBitArray<>* FindTypeSlots(EMusicNewsType NewsType) const;
+    const TBitArray<>* FindSourceSlots(FName Source) const;
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FSourceSlots
+    {
+        TBitArray<> Slots;
+
+        /** Items from the source still kept; the entry goes away at zero so old sources do not pile up. */
+        int32 Num = 0;
+    };
+
+    TBitArray<>& FindOrAddSlots(TArray<TBitArray<>>& Bitmaps, int32 Index);
+
+    int32 NumSlots = 0;
+    TBitArray<> LiveSlots;
+    TArray<TBitArray<>> TagSlots;
+    TArray<TBitArray<>> TypeSlots;
+    TMap<FName, FSourceSlots> SourceSlots;
+};
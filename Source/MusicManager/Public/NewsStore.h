@@ -0,0 +1,194 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.h"
+#include "NewsIndex.h"
+
+/** A string in an FNewsStore's text arena. */
+struct FNewsText
+{
+    uint32 Offset = 0;
+    uint32 Length = 0;
+};
+
+/** One news item as the store keeps it: interned names, arena text and a tag bitmask. */
+struct FNewsRecord
+{
+    int64 TimestampTicks = 0;
+
+    /** Bit N set means the item carries the store's tag N. */
+    uint64 TagMask = 0;
+
+    FName Source;
+
+    FNewsText Subject;
+    FNewsText Headline;
+    FNewsText Body;
+
+    int32 ReputationDelta = 0;
+    int32 RevenueDelta = 0;
+
+    /** Range of the item's entries in the store's metadata array. */
+    uint32 FirstMetadata = 0;
+    uint16 NumMetadata = 0;
+
+    EMusicNewsType NewsType = EMusicNewsType::None;
+
+    /** When set, Headline and Body are empty and the text comes from FNewsTextTemplates. */
+    ENewsTextTemplate TextTemplate = ENewsTextTemplate::None;
+    float TextAmount = 0.f;
+
+    /** Stood for by a roundup item; the feed shows the roundup instead. */
+    bool bRolledUp = false;
+};
+
+/**
+ * Compact storage for the news history.
+ *
+ * Everything that repeats across items is stored once: sources and metadata keys are FNames, tags are bits in
+ * a per-item mask over a table of up to 64 tag names, and headline, subject and body text live as UTF-8 in a
+ * single arena where identical strings share their bytes. Items are addressed by FNewsHandle, so handing one
+ * to the feed or a widget copies four bytes instead of an FMusicNewsEvent.
+ *
+ * The store is a ring: once it holds Capacity items, each new one evicts the oldest. Text and metadata of
+ * evicted items are reclaimed in one pass every Capacity evictions, so memory stays bounded by the retention
+ * no matter how long the campaign runs.
+ *
+ * An FNewsIndex over the ring's slots is kept up to date on every add and eviction, so filtering the history by
+ * tag, type and source is a few bitmap operations rather than a scan.
+ *
+ * Game thread only.
+ */
+class MUSICMANAGER_API FNewsStore
+{
+public:
+    static constexpr int32 MaxTags = 64;
+    static constexpr int32 DefaultCapacity = 1024;
+
+    /** Changes how many items are kept, evicting the oldest if there are now too many. */
+    void SetCapacity(int32 InCapacity);
+
+    int32 GetCapacity() const { return Capacity; }
+
+    /** Interns the event and returns its handle. The event's NewsId is not kept; the handle identifies the item. */
+    FNewsHandle Add(const FMusicNewsEvent& Event);
+
+    /** The item's record, or null if the handle is invalid or the item has been evicted. */
+    const FNewsRecord* Find(FNewsHandle Handle) const;
+
+    bool Contains(FNewsHandle Handle) const { return Find(Handle) != nullptr; }
+
+    /** Marks the item as covered by a roundup. Does nothing if it has been evicted. */
+    void MarkRolledUp(FNewsHandle Handle);
+
+    int32 Num() const { return NumRecords; }
+
+    /** Handle of the most recently added item, or an invalid handle if the store is empty. */
+    FNewsHandle GetNewestHandle() const;
+
+    /** Handle of the oldest item still kept, or an invalid handle if the store is empty. */
+    FNewsHandle GetOldestHandle() const;
+
+    FUtf8StringView GetText(const FNewsText& Text) const
+    {
+        return FUtf8StringView(TextArena.GetData() + Text.Offset, Text.Length);
+    }
+
+    FName GetTagName(int32 TagIndex) const { return TagNames[TagIndex]; }
+
+    /** Bit for Tag in FNewsRecord::TagMask, or zero if no item has carried it. */
+    uint64 GetTagBit(FName Tag) const;
+
+    /** Calls Visitor with the name of every tag in Mask, lowest bit first. */
+    template <typename VisitorType>
+    void ForEachTag(uint64 Mask, VisitorType&& Visitor) const
+    {
+        while (Mask != 0)
+        {
+            const int32 TagIndex = static_cast<int32>(FMath::CountTrailingZeros64(Mask));
+            Visitor(TagNames[TagIndex]);
+            Mask &= Mask - 1;
+        }
+    }
+
+    /**
+     * Finds the items that match Query. Writes up to MaxResults handles to OutNews, newest first, and returns
+     * the number of matches in total.
+     */
+    int32 Query(const FNewsQuery& Query, TArray<FNewsHandle>& OutNews, int32 MaxResults = MAX_int32) const;
+
+    /** Calls Visitor with the key and value of each of the item's metadata entries. */
+    template <typename VisitorType>
+    void ForEachMetadata(const FNewsRecord& Record, VisitorType&& Visitor) const
+    {
+        for (uint32 EntryIndex = Record.FirstMetadata; EntryIndex < Record.FirstMetadata + Record.NumMetadata; ++EntryIndex)
+        {
+            Visitor(Metadata[EntryIndex].Key, GetText(Metadata[EntryIndex].Value));
+        }
+    }
+
+    /** Rebuilds a full event for code that still works on FMusicNewsEvent. Allocates; keep it off hot paths. */
+    bool MakeEvent(FNewsHandle Handle, FMusicNewsEvent& OutEvent) const;
+
+    /**
+     * Writes the kept items as a compact chunk for save games: text and names are written once in tables and
+     * referred to by varint index, timestamps are varint deltas in seconds and tags stay bitmasks.
+     */
+    void SaveHistory(TArray<uint8>& OutBytes) const;
+
+    /** Replaces the store's items with a chunk written by SaveHistory. Leaves the store empty and returns false if it cannot be read. */
+    bool LoadHistory(TConstArrayView<uint8> Bytes);
+
+    /** Heap memory held by the store, for stats and budgets. */
+    SIZE_T GetAllocatedSize() const;
+
+    void Reset();
+
+private:
+    struct FMetadataEntry
+    {
+        FName Key;
+        FNewsText Value;
+    };
+
+    FNewsText InternText(const FString& Text);
+    FNewsText InternText(FUtf8StringView Text);
+    uint64 InternTags(const TArray<FString>& Tags);
+
+    int32 GetSlot(uint32 Sequence) const { return static_cast<int32>((Sequence - 1) % static_cast<uint32>(Capacity)); }
+
+    /** Sequence of the item in a live slot. */
+    uint32 GetSequence(int32 Slot) const;
+
+    /** Puts a record whose text and metadata are already interned into the ring. */
+    FNewsHandle AddRecord(const FNewsRecord& Record);
+
+    /** Rebuilds the text arena and metadata from the items still kept, dropping what evicted items left behind. */
+    void Compact();
+
+    /** Ring of records; the item with sequence S lives in slot GetSlot(S). */
+    TArray<FNewsRecord> Records;
+    int32 Capacity = DefaultCapacity;
+    int32 NumRecords = 0;
+    int32 NumEvictedSinceCompact = 0;
+
+    /** Sequence the next item will get. Sequences start at one so the zero handle stays invalid. */
+    uint32 NextSequence = 1;
+
+    TArray<FMetadataEntry> Metadata;
+    TArray<UTF8CHAR> TextArena;
+
+    /** Arena strings by content hash, so repeated text is stored once. */
+    TMultiMap<uint32, FNewsText> TextByHash;
+
+    TArray<FName, TInlineAllocator<MaxTags>> TagNames;
+    TMap<FName, int32> TagIndices;
+
+    bool bWarnedTagOverflow = false;
+
+    FNewsIndex Index;
+
+    // Scratch bitmaps for Query, kept so filtering does not allocate each time.
+    mutable TBitArray<> QueryMatches;
+    mutable TBitArray<> QueryTerm;
+};
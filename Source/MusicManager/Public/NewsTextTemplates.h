@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.h"
+
+struct FNewsRecord;
+class FNewsStore;
+
+/**
+ * Localized text for news items.
+ *
+ * Generated news is stored as an ENewsTextTemplate plus its arguments, and these functions turn it into text
+ * only when a card shows the item. Templates can use {Subject}, {Source}, {Amount}, {Month} and any metadata
+ * key of the item. The formats and the month name tables are compiled once and reused; they
+ * follow culture changes on their own, so nothing here needs rebuilding when the language switches.
+ */
+struct MUSICMANAGER_API FNewsTextTemplates
+{
+    static FText FormatHeadline(const FNewsRecord& Record, const FNewsStore& Store);
+    static FText FormatBody(const FNewsRecord& Record, const FNewsStore& Store);
+
+    /** Month of the year, 1-12, e.g. "March". */
+    static const FText& GetMonthName(int32 Month);
+
+    /** Abbreviated month of the year, 1-12, e.g. "Mar". */
+    static const FText& GetShortMonthName(int32 Month);
+
+    /** e.g. "March 1965". */
+    static FText FormatMonthYear(const FDateTime& Date);
+
+    /** e.g. "Mar 01, 1965", the date shown on news cards. */
+    static FText FormatCardDate(const FDateTime& Date);
+};
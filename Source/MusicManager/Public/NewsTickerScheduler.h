@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MusicNewsTypes.h"
+
+/** What the ticker shows next: a single item, or several items of one type to be rolled up into one card. */
+struct FNewsTickerRelease
+{
+    EMusicNewsType NewsType = EMusicNewsType::None;
+
+    /** Oldest first. More than one means a roundup. */
+    TArray<FNewsHandle> News;
+
+    bool IsRoundup() const { return News.Num() > 1; }
+};
+
+/**
+ * Queue of news waiting to reach the ticker.
+ *
+ * Items wait in one group per news type. Each release takes from the group whose type matters most, oldest
+ * group first on ties; a group that has gathered CollapseThreshold or more items is released whole, so a month
+ * that signs five artists shows one roundup instead of five cards. Smaller groups give up their oldest item.
+ *
+ * The scheduler only decides order; how often to release is up to its owner. There are only as many groups as
+ * news types, so picking one is a short scan.
+ */
+class MUSICMANAGER_API FNewsTickerScheduler
+{
+public:
+    /** How much a type of news matters, higher first. Shared with the feed's priority sort. */
+    static int32 GetTypePriority(EMusicNewsType NewsType);
+
+    void Add(FNewsHandle News, EMusicNewsType NewsType);
+
+    /** Takes the next release. Returns false if nothing is waiting. */
+    bool Pop(FNewsTickerRelease& OutRelease);
+
+    bool IsEmpty() const { return Groups.IsEmpty(); }
+
+    void Reset() { Groups.Reset(); }
+
+    /** Waiting items of one type at which they are released as a single roundup. */
+    int32 CollapseThreshold = 3;
+
+private:
+    struct FGroup
+    {
+        EMusicNewsType NewsType = EMusicNewsType::None;
+        int32 Priority = 0;
+        TArray<FNewsHandle> News;
+    };
+
+    TArray<FGroup> Groups;
+};
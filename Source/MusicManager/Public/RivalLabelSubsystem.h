@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameMonth.h"
+#include "SimulationModels.h"
+#include "RivalLabelSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogRivalLabels, Log, All);
+
+/**
+ * One row of the singles chart, from either the player's label or a rival.
+ */
+USTRUCT(BlueprintType)
+struct FChartEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    FString SongName;
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    FString ArtistName;
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    FString LabelName;
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    float Popularity = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    int32 ChartWeeks = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="Charts")
+    bool bPlayerLabel = false;
+};
+
+/**
+ * Simulates the AI record labels competing with the player.
+ *
+ * Every rival artist slot is a plain FContractSimState plus its current single as an FSongSimState, stored in
+ * flat arrays and sliced per label. The month step runs one ParallelFor task per label with the same models the
+ * player's contracts and songs use, then merges the results into the chart and a handful of rival news items.
+ *
+ * The step is a worker stage in the Market phase and only touches rival data; the new chart is published and
+ * the news posted from a game-thread stage in the News phase.
+ */
+UCLASS(Config=Game)
+class MUSICMANAGER_API URivalLabelSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Market phase worker stage: steps every rival label and ranks the new chart. */
+    bool StepMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+    /** News phase game-thread stage: makes the new chart visible and posts rival news. */
+    bool PublishMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+    /** Rival singles ranked by popularity as of the last month step. */
+    const TArray<FChartEntry>& GetRivalChart() const { return RivalChart; }
+
+    /** Merges the player's top songs with the rival chart into a single ranking. */
+    UFUNCTION(BlueprintCallable, Category="Charts")
+    TArray<FChartEntry> GetCombinedChart(int32 Count) const;
+
+    UFUNCTION(BlueprintPure, Category="Rivals")
+    int32 GetNumRivalLabels() const { return Labels.Num(); }
+
+    /** Wall time of the last month step in milliseconds. */
+    UFUNCTION(BlueprintPure, Category="Rivals")
+    float GetLastMonthStepMilliseconds() const { return LastMonthStepMilliseconds; }
+
+protected:
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="0", ClampMax="64"))
+    int32 NumRivalLabels = 20;
+
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="1", ClampMax="2048"))
+    int32 ArtistSlotsPerLabel = 250;
+
+    /** Target wall time for one rival month step; exceeding it is logged. */
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="0.1"))
+    float MonthBudgetMilliseconds = 5.f;
+
+    /** Share of its cash a label may spend on signing bonuses in one month. Labels in debt do not sign. */
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="0", ClampMax="1"))
+    float SigningBudgetShare = 0.1f;
+
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="1", ClampMax="100"))
+    int32 ChartSize = 20;
+
+    /** Upper bound on rival news items posted per month. */
+    UPROPERTY(EditAnywhere, Config, Category="Rivals", meta=(ClampMin="0", ClampMax="10"))
+    int32 MaxNewsPerMonth = 2;
+
+    UPROPERTY(EditAnywhere, Config, Category="Rivals")
+    int32 WorldSeed = 1955;
+
+private:
+    struct FRivalLabel
+    {
+        FString Name;
+        int32 FirstSlot = 0;
+        int32 NumSlots = 0;
+        float Cash = 0.f;
+    };
+
+    /** What a label's month task produced; written only by that task. */
+    struct FRivalLabelMonth
+    {
+        float Revenue = 0.f;
+        float Cost = 0.f;
+        int32 Signings = 0;
+        int32 Expirations = 0;
+        int32 Releases = 0;
+    };
+
+    void SeedLabels();
+    void SimulateLabelMonth(int32 LabelIndex, int32 MonthSeed);
+    void RebuildChart();
+    void PostRivalNews(const FGameMonth& NewMonth);
+
+    FString MakeArtistName(int32 Slot) const;
+    FString MakeSongName(int32 Slot) const;
+
+    TArray<FRivalLabel> Labels;
+    TArray<FRivalLabelMonth> LabelMonths;
+
+    // Per artist slot, indexed identically.
+    TArray<FContractSimState> SlotContracts;
+    TArray<FSongSimState> SlotSingles;
+    TArray<uint32> SlotArtistSeeds;
+    TArray<uint32> SlotSingleSeeds;
+    TArray<uint8> SlotContractActive;
+    TArray<uint8> SlotSingleCharting;
+
+    TArray<FChartEntry> RivalChart;
+
+    /** Chart built by the worker stage, swapped into RivalChart on the game thread. */
+    TArray<FChartEntry> PendingChart;
+
+    FDelegateHandle StepStageHandle;
+    FDelegateHandle PublishStageHandle;
+
+    /** Slot holding the rival #1 after the previous month, used to detect a new chart topper. */
+    int32 PreviousTopSlot = INDEX_NONE;
+
+    bool bTopSlotChanged = false;
+
+    int32 MonthsSimulated = 0;
+
+    float LastMonthStepMilliseconds = 0.f;
+    float PendingMonthStepMilliseconds = 0.f;
+};
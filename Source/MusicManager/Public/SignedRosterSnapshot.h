@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AuditionTypes.h"
+
+/**
+ * Immutable view of the player's signed roster. Rebuilt only when the roster changes and shared by pointer
+ * with every consumer, so widgets can compare versions instead of contents.
+ */
+struct FSignedRosterSnapshot
+{
+    /** Increases every time the roster changes. Zero marks an ad-hoc snapshot that should always be applied. */
+    uint32 Version = 0;
+
+    TArray<FArtistData> Artists;
+};
+
+using FSignedRosterSnapshotRef = TSharedRef<const FSignedRosterSnapshot, ESPMode::ThreadSafe>;
+using FSignedRosterSnapshotPtr = TSharedPtr<const FSignedRosterSnapshot, ESPMode::ThreadSafe>;
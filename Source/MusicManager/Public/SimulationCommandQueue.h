@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Player commands against simulation state that a month pipeline worker stage steps.
+ *
+ * The owner holds the queue from the moment its month begins until the worker's results are published back on
+ * the game thread. Commands issued in that window are kept and replayed in order on release; the rest of the
+ * time they run immediately. Game thread only.
+ */
+class FSimulationCommandQueue
+{
+public:
+    /** Hands the simulated state to the worker; commands are deferred until Release. */
+    void Hold()
+    {
+        check(IsInGameThread());
+        bHeld = true;
+    }
+
+    /** Takes the simulated state back and replays every deferred command in the order it was issued. */
+    void Release()
+    {
+        check(IsInGameThread());
+        bHeld = false;
+
+        // Moved out first so replayed commands that issue further commands run them directly.
+        TArray<TUniqueFunction<void()>> Commands = MoveTemp(PendingCommands);
+        for (TUniqueFunction<void()>& Command : Commands)
+        {
+            Command();
+        }
+    }
+
+    bool IsHeld() const { return bHeld; }
+
+    int32 GetNumPending() const { return PendingCommands.Num(); }
+
+    /** Runs Command now, or once the queue is released if the worker currently owns the state. */
+    void Run(TUniqueFunction<void()>&& Command)
+    {
+        check(IsInGameThread());
+
+        if (bHeld)
+        {
+            PendingCommands.Add(MoveTemp(Command));
+        }
+        else
+        {
+            Command();
+        }
+    }
+
+    /** Drops deferred commands, for when the state they target is replaced wholesale. */
+    void Reset()
+    {
+        PendingCommands.Reset();
+        bHeld = false;
+    }
+
+private:
+    TArray<TUniqueFunction<void()>> PendingCommands;
+    bool bHeld = false;
+};
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AuditionTypes.h"
+#include "CowChunkedArray.h"
+#include "FArtistDealTerms.h"
+#include "GameMonth.h"
+#include "SimulationModels.h"
+#include "SimulationFork.generated.h"
+
+/** A signing to try out in a preview. */
+USTRUCT(BlueprintType)
+struct FWhatIfSigning
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf")
+    FArtistDealTerms Deal;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf")
+    FArtistData Artist;
+
+    /** Months from now until the contract is signed; zero signs it this month. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf", meta=(ClampMin="0"))
+    int32 DelayMonths = 0;
+};
+
+/** An active song whose release is moved in a preview. It does not chart until then. */
+USTRUCT(BlueprintType)
+struct FWhatIfRelease
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf")
+    FString SongId;
+
+    /** Months from now until the song is released; zero releases it this month. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf", meta=(ClampMin="0"))
+    int32 DelayMonths = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FSimulationWhatIf
+{
+    GENERATED_BODY()
+
+    static constexpr int32 MaxMonthsToSimulate = 240;
+
+    /** Clamped to [1, MaxMonthsToSimulate] when the fork runs, whoever set it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf", meta=(ClampMin="1", ClampMax="240"))
+    int32 MonthsToSimulate = 12;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf")
+    TArray<FWhatIfSigning> Signings;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="WhatIf")
+    TArray<FWhatIfRelease> Releases;
+};
+
+/** How a song named by a FWhatIfRelease fared over the preview. */
+USTRUCT(BlueprintType)
+struct FWhatIfSongOutcome
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    FString SongId;
+
+    /** False if the song is not among the active songs the preview was forked from. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    bool bFound = false;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float PeakPopularity = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float FinalPopularity = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 ChartWeeks = 0;
+
+    /** Dropped below the archive threshold before the preview ended. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    bool bFaded = false;
+};
+
+/** Outcome of running a forked simulation forward. */
+USTRUCT(BlueprintType)
+struct FSimulationForkReport
+{
+    GENERATED_BODY()
+
+    /** Identifier returned by USimulationPreviewSubsystem::PreviewWhatIf for the request that produced this report. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 RequestId = 0;
+
+    /** Month the fork was taken; the preview covers the months after it. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    FGameMonth StartMonth;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 MonthsSimulated = 0;
+
+    /** Label profit from contracts in each simulated month, including sign-up bonuses paid that month. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    TArray<float> MonthlyProfit;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float TotalRevenue = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float TotalCost = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float NetProfit = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 RecordsDelivered = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 ContractsExpired = 0;
+
+    /** Songs above the charting threshold at the end of the preview. */
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    int32 ChartingSongs = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    TArray<FWhatIfSongOutcome> Songs;
+
+    UPROPERTY(BlueprintReadOnly, Category="WhatIf")
+    float ElapsedMilliseconds = 0.f;
+};
+
+/**
+ * Songs, contracts and date as the headless month model sees them. Copies share their chunks, so forking the
+ * live state for several previews costs a few references each; a fork only pays for the chunks it changes.
+ */
+struct FSimulationForkState
+{
+    struct FSong
+    {
+        FSongSimState State;
+
+        /** First month the song is stepped. */
+        FGameMonth ActiveFrom;
+
+        bool bFaded = false;
+    };
+
+    struct FContract
+    {
+        FContractSimState State;
+
+        /** First month the contract is stepped. */
+        FGameMonth ActiveFrom;
+
+        /** Last month the contract is stepped; it expires right after. */
+        FGameMonth ExpiryMonth;
+    };
+
+    /** Month the state was captured in. */
+    FGameMonth Month;
+
+    /** The live campaign's seed, so the fork rolls the same viral spikes as the game will. */
+    int32 CampaignSeed = 0;
+
+    TCowChunkedArray<FSong> Songs;
+    TCowChunkedArray<FContract> Contracts;
+
+    /** Ids of Songs, by index. Shared and never changed by forks. */
+    TSharedRef<const TArray<FString>, ESPMode::ThreadSafe> SongIds = MakeShared<TArray<FString>, ESPMode::ThreadSafe>();
+};
+
+/**
+ * Runs a fork of the simulation forward with the same models and the same per-month random streams as the live
+ * subsystems, so a fork without changes tracks the live game month for month.
+ */
+class FSimulationFork
+{
+public:
+    /** Blocking; meant for a worker. State is taken by value, which shares its chunks with the caller's copy. */
+    static void Run(FSimulationForkState State, const FSimulationWhatIf& WhatIf, FSimulationForkReport& OutReport);
+};
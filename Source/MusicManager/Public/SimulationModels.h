@@ -0,0 +1,229 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FArtistContract.h"
+#include "FSongData.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Scalar state of a contract as seen by the monthly financial model.
+ * Kept free of strings so forecasts and headless simulations can step it without allocating.
+ */
+struct FContractSimState
+{
+    float PopularityFactor = 0.1f;
+    float PerformanceScore = 0.f;
+    float PerformanceMomentum = 0.f;
+    float RoyaltyRate = 0.f;
+    float MonthlyUpkeepCost = 0.f;
+    float ProductionProgress = 0.f;
+    int32 MonthsActive = 0;
+    int32 ContractMonths = 0;
+    int32 NumRecords = 0;
+    int32 RecordsDelivered = 0;
+};
+
+/** Money and output produced by a single simulated contract month. */
+struct FContractMonthResult
+{
+    float GrossRevenue = 0.f;
+    float RoyaltyPayment = 0.f;
+    float UpkeepCost = 0.f;
+    int32 CompletedRecords = 0;
+};
+
+/** Scalar popularity state of a song as seen by the monthly chart model. */
+struct FSongSimState
+{
+    float HitPotential = 0.f;
+    float Innovation = 0.f;
+    float TrendAlignment = 0.f;
+    float ViralPotential = 0.f;
+    float CurrentPopularity = 0.f;
+    int32 ChartWeeks = 0;
+};
+
+/**
+ * Pure monthly simulation formulas shared by the live subsystems, forecasts and headless simulations.
+ */
+namespace MusicSimulation
+{
+    inline int32 GetContractDurationMonths(const FArtistDealTerms& Deal)
+    {
+        return FMath::Max(Deal.ContractYears * 12, 0);
+    }
+
+    /**
+     * Last month a contract is settled before it expires: its end month or the month it reaches its full
+     * length, whichever comes first.
+     */
+    inline FGameMonth GetContractExpiryMonth(const FArtistContract& Contract, const FGameMonth& CurrentMonth)
+    {
+        const int32 MonthsRemaining = GetContractDurationMonths(Contract.Terms) - Contract.MonthsActive;
+        if (!Contract.EndMonth.IsValid())
+        {
+            return CurrentMonth + MonthsRemaining;
+        }
+        return FMath::Min(Contract.EndMonth, CurrentMonth + MonthsRemaining);
+    }
+
+    inline float GetMonthlyUpkeepCost(const FArtistData& Artist)
+    {
+        return 2000.f + Artist.PerformanceScore * 25.f;
+    }
+
+    inline float GetPopularityFactor(const FArtistData& Artist)
+    {
+        const float AudienceComposite = Artist.AudienceEngagement + Artist.StagePresence + Artist.PerformanceScore;
+        const float CreativeComposite = Artist.VocalQuality + Artist.SongwritingQuality;
+        return FMath::Clamp((AudienceComposite + CreativeComposite) / 500.f, 0.1f, 2.5f);
+    }
+
+    /** Builds the state of a freshly signed contract, matching UArtistManagerSubsystem::SignArtist. */
+    inline FContractSimState MakeContractState(const FArtistDealTerms& Deal, const FArtistData& Artist)
+    {
+        FContractSimState State;
+        State.PopularityFactor = GetPopularityFactor(Artist);
+        State.PerformanceScore = Artist.PerformanceScore;
+        State.PerformanceMomentum = Artist.PerformanceScore;
+        State.RoyaltyRate = Deal.RoyaltyRate;
+        State.MonthlyUpkeepCost = GetMonthlyUpkeepCost(Artist);
+        State.ContractMonths = GetContractDurationMonths(Deal);
+        State.NumRecords = Deal.NumRecords;
+        return State;
+    }
+
+    inline FContractSimState MakeContractState(const FArtistContract& Contract)
+    {
+        FContractSimState State;
+        State.PopularityFactor = GetPopularityFactor(Contract.ArtistData);
+        State.PerformanceScore = Contract.ArtistData.PerformanceScore;
+        State.PerformanceMomentum = Contract.PerformanceMomentum;
+        State.RoyaltyRate = Contract.Terms.RoyaltyRate;
+        State.MonthlyUpkeepCost = Contract.MonthlyUpkeepCost;
+        State.ProductionProgress = Contract.ProductionProgress;
+        State.MonthsActive = Contract.MonthsActive;
+        State.ContractMonths = GetContractDurationMonths(Contract.Terms);
+        State.NumRecords = Contract.Terms.NumRecords;
+        State.RecordsDelivered = Contract.RecordsDelivered;
+        return State;
+    }
+
+    /**
+     * Advances a contract by one month of revenue, royalties, upkeep and record production.
+     * PerformanceSample is the artist's performance this month; the live game uses their audition score.
+     */
+    inline FContractMonthResult StepContractMonth(FContractSimState& State, float PerformanceSample)
+    {
+        FContractMonthResult Result;
+
+        State.MonthsActive++;
+
+        State.PerformanceMomentum = FMath::Clamp(State.PerformanceMomentum * 0.85f + PerformanceSample * 0.15f, 0.f, 100.f);
+
+        const float MomentumMultiplier = 1.f + (State.PerformanceMomentum / 200.f);
+        Result.GrossRevenue = (12000.f + State.MonthsActive * 400.f) * State.PopularityFactor * MomentumMultiplier;
+        Result.RoyaltyPayment = Result.GrossRevenue * (State.RoyaltyRate / 100.f);
+        Result.UpkeepCost = State.MonthlyUpkeepCost;
+
+        const int32 ContractMonths = FMath::Max(State.ContractMonths, 1);
+        const float RecordsPerMonth = State.NumRecords > 0 ? static_cast<float>(State.NumRecords) / static_cast<float>(ContractMonths) : 0.f;
+        State.ProductionProgress += RecordsPerMonth;
+
+        if (State.ProductionProgress >= 1.f && State.NumRecords > State.RecordsDelivered)
+        {
+            Result.CompletedRecords = FMath::Clamp(static_cast<int32>(State.ProductionProgress), 0, State.NumRecords - State.RecordsDelivered);
+            State.RecordsDelivered += Result.CompletedRecords;
+            State.ProductionProgress -= Result.CompletedRecords;
+        }
+
+        return Result;
+    }
+
+    inline FContractMonthResult StepContractMonth(FContractSimState& State)
+    {
+        return StepContractMonth(State, State.PerformanceScore);
+    }
+
+    /** Writes a stepped contract month back into the contract and its lifetime totals. */
+    inline void ApplyContractMonth(FArtistContract& Contract, const FContractSimState& State, const FContractMonthResult& Month)
+    {
+        Contract.MonthsActive = State.MonthsActive;
+        Contract.PerformanceMomentum = State.PerformanceMomentum;
+
+        Contract.LastRoyaltyPayment = Month.RoyaltyPayment;
+        Contract.CumulativeRoyaltyPaid += Month.RoyaltyPayment;
+
+        Contract.LifetimeRevenue += Month.GrossRevenue;
+        Contract.LifetimeCost += Month.RoyaltyPayment + Month.UpkeepCost;
+
+        Contract.RecordsDelivered = State.RecordsDelivered;
+        Contract.ProductionProgress = State.ProductionProgress;
+    }
+
+    /** Upper bound of the random viral spike multiplier rolled for each song every month. */
+    constexpr float MaxViralRoll = 0.4f;
+
+    /** A fresh seed for a new campaign's random streams. */
+    inline int32 MakeCampaignSeed()
+    {
+        return static_cast<int32>(GetTypeHash(FGuid::NewGuid()));
+    }
+
+    /**
+     * Stream of one month's viral rolls, drawn in active song order. The same campaign and month always roll the
+     * same spikes, so a replayed month or a preview fork matches the live game; other campaigns roll their own.
+     */
+    inline FRandomStream MakeViralRollStream(int32 CampaignSeed, const FGameMonth& Month)
+    {
+        return FRandomStream(static_cast<int32>(HashCombine(static_cast<uint32>(CampaignSeed), GetTypeHash(Month))));
+    }
+
+    /** Songs whose popularity falls below this after a month drop out of the simulation. */
+    constexpr float ArchivePopularity = 5.f;
+
+    /** Songs above this popularity are on the charts and accumulate chart weeks. */
+    constexpr float ChartingPopularity = 20.f;
+
+    inline FSongSimState MakeSongState(const FSongData& Data)
+    {
+        FSongSimState State;
+        State.HitPotential = Data.HitPotential;
+        State.Innovation = Data.Innovation;
+        State.TrendAlignment = Data.TrendAlignment;
+        State.ViralPotential = Data.ViralPotential;
+        State.CurrentPopularity = Data.CurrentPopularity;
+        State.ChartWeeks = Data.ChartWeeks;
+        return State;
+    }
+
+    /** Rolls the chart-relevant qualities of a new song using the same ranges as USongManagerSubsystem::CreateSong. */
+    inline FSongSimState MakeRandomSongState(FRandomStream& Stream)
+    {
+        FSongSimState State;
+        State.HitPotential = Stream.FRandRange(40.f, 90.f);
+        State.Innovation = Stream.FRandRange(10.f, 90.f);
+        State.TrendAlignment = Stream.FRandRange(10.f, 100.f);
+        State.ViralPotential = Stream.FRandRange(0.f, 100.f);
+        return State;
+    }
+
+    /** Advances a song's popularity by one month. ViralRoll is a random value in [0, MaxViralRoll]. */
+    inline void StepSongMonth(FSongSimState& State, float ViralRoll)
+    {
+        const float BaseGrowth = State.HitPotential * 0.05f;         // Great songs grow faster in general.
+        const float InnovationBoost = State.Innovation * 0.02f;       // Innovation keeps the track exciting.
+        const float TrendFactor = State.TrendAlignment * 0.03f;       // Trend alignment rides cultural waves.
+        const float ViralBoost = State.ViralPotential * ViralRoll;    // Random viral spikes.
+        const float AgingDecay = State.ChartWeeks * 0.4f;             // Songs cool off over time.
+
+        State.CurrentPopularity += BaseGrowth + InnovationBoost + TrendFactor + ViralBoost - AgingDecay;
+        State.CurrentPopularity = FMath::Clamp(State.CurrentPopularity, 0.0f, 100.0f);
+
+        if (State.CurrentPopularity > ChartingPopularity)
+        {
+            // Songs that remain relevant accumulate chart weeks.
+            ++State.ChartWeeks;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SimulationFork.h"
+#include "SongChartSnapshot.h"
+#include "SimulationPreviewSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSimulationPreview, Log, All);
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnWhatIfPreviewed, const FSimulationForkReport&, Report);
+
+/**
+ * Answers "what if" questions by forking the player's songs and contracts and running the fork ahead on a worker.
+ *
+ * The fork point is captured from the last published month and kept until the month, the chart or the roster
+ * changes, so every preview in between starts from the same shared chunks instead of copying the catalog.
+ */
+UCLASS(Config=Game)
+class MUSICMANAGER_API USimulationPreviewSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Runs WhatIf on a fork of the current simulation and reports on the game thread. Previews are independent,
+     * so comparing two options means issuing two requests; the live game is never touched.
+     */
+    UFUNCTION(BlueprintCallable, Category="Simulation")
+    int32 PreviewWhatIf(const FSimulationWhatIf& WhatIf, const FOnWhatIfPreviewed& OnComplete);
+
+    /** Fork of the live simulation. Cheap: shares its chunks with the cached fork point. */
+    FSimulationForkState ForkLiveState();
+
+protected:
+    /** Wall time a preview is expected to fit in; slower ones are logged. */
+    UPROPERTY(EditAnywhere, Config, Category="Simulation", meta=(ClampMin="1.0"))
+    float PreviewBudgetMilliseconds = 30.f;
+
+private:
+    /** True if the live state has moved on since the fork point was captured. */
+    bool IsForkPointStale() const;
+
+    void CaptureForkPoint();
+
+    FSimulationForkState ForkPoint;
+
+    // What the fork point was captured from.
+    FGameMonth ForkPointMonth;
+    FSongChartSnapshotPtr ForkPointChart;
+    uint32 ForkPointRosterVersion = 0;
+    int32 ForkPointNumSongs = INDEX_NONE;
+
+    int32 LastRequestId = 0;
+};
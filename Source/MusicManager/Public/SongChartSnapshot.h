@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameMonth.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USong;
+
+/**
+ * Immutable ranking of the player's active songs, published once per month when the song step completes.
+ * Readers keep the pointer for as long as they like; a new month replaces it rather than changing it.
+ */
+struct FSongChartSnapshot
+{
+    /** Month the ranking was published for. Unset for a snapshot built outside the month pipeline. */
+    FGameMonth Month;
+
+    /** Active songs by popularity, highest first. */
+    TArray<TWeakObjectPtr<USong>> SongsByPopularity;
+};
+
+using FSongChartSnapshotRef = TSharedRef<const FSongChartSnapshot, ESPMode::ThreadSafe>;
+using FSongChartSnapshotPtr = TSharedPtr<const FSongChartSnapshot, ESPMode::ThreadSafe>;
@@ -2,6 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "GameMonth.h"
+#include "GameCalendarSubsystem.h"
+#include "SimulationCommandQueue.h"
+#include "SimulationModels.h"
+#include "SongChartSnapshot.h"
 #include "SongManagerSubsystem.generated.h"
 
 class USong;
@@ -9,6 +14,11 @@ class UMusicSaveGame;
 
 /**
  * Subsystem that owns and simulates all song instances for the project.
+ *
+ * Popularity is stepped on a worker: each active song has a plain FSongSimState the Songs phase worker stage
+ * advances, and the results are copied back into the USong objects and ranked into a new chart snapshot from a
+ * News phase stage. Until then the game thread keeps seeing last month's values, and new songs wait in the
+ * command queue.
  */
 UCLASS()
 class MUSICMANAGER_API USongManagerSubsystem : public UGameInstanceSubsystem
@@ -20,22 +30,34 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
-    // Create a new song owned by an artist.
+    // Create a new song owned by an artist. It joins the simulation as soon as no month step is in flight.
     UFUNCTION(BlueprintCallable, Category = "Songs")
     USong* CreateSong(const FString& ArtistId, const FString& SongName, const FString& Genre);
 
-    // Mark a song as released at a specific date.
+    // Mark a song as released in a specific month.
     UFUNCTION(BlueprintCallable, Category = "Songs")
-    void ReleaseSong(USong* Song, const FDateTime& ReleaseDate);
+    void ReleaseSong(USong* Song, const FGameMonth& ReleaseMonth);
 
-    // Handle monthly time advancement from UGameTimeSubsystem.
-    UFUNCTION()
-    void HandleMonthAdvanced(const FDateTime& NewDate);
+    // Release a song once the simulation reaches ReleaseMonth. Rescheduling a song replaces its earlier date.
+    UFUNCTION(BlueprintCallable, Category = "Songs")
+    void ScheduleSongRelease(USong* Song, const FGameMonth& ReleaseMonth);
+
+    // Songs phase worker stage: steps the simulated state of every active song and ranks the result.
+    bool StepMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+    // News phase game-thread stage: copies the stepped state into the songs, archives and publishes the chart.
+    bool PublishMonth(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
 
     // Query helpers for UI and gameplay.
     UFUNCTION(BlueprintCallable, Category = "Songs")
     TArray<USong*> GetTopSongs(int32 Count) const;
 
+    // Ranking published with the last completed month.
+    FSongChartSnapshotRef GetChartSnapshot() const
+    {
+        return ChartSnapshot;
+    }
+
     UFUNCTION(BlueprintCallable, Category = "Songs")
     TArray<USong*> GetSongsByArtist(const FString& ArtistId) const;
 
@@ -43,6 +65,12 @@ public:
     void SaveState(UMusicSaveGame* SaveObject);
     void LoadState(const UMusicSaveGame* SaveObject);
 
+    // Seed of this campaign's viral rolls; previews fork it along with the songs.
+    int32 GetCampaignSeed() const
+    {
+        return CampaignSeed;
+    }
+
     // Access to all active songs (read-only).
     const TArray<TObjectPtr<USong>>& GetAllActiveSongs() const
     {
@@ -61,13 +89,48 @@ private:
     UPROPERTY()
     TArray<TObjectPtr<USong>> ActiveSongs;
 
+    // Registration with the UGameTimeSubsystem month pipeline.
+    FDelegateHandle MonthStageHandle;
+    FDelegateHandle PublishStageHandle;
+    FDelegateHandle MonthBegunHandle;
+
+    // Simulated state of each active song, indexed like ActiveSongs. Owned by the worker while Commands is held.
+    TArray<FSongSimState> SimSongs;
+
+    // SimSongs indices by popularity, written by the worker stage for PublishMonth.
+    TArray<int32> PendingChartOrder;
+
+    // SimSongs indices of songs that charted for the first time in the step, for the month's news.
+    TArray<int32> PendingChartEntries;
+
+    FSongChartSnapshotRef ChartSnapshot = MakeShared<FSongChartSnapshot, ESPMode::ThreadSafe>();
+
+    // Made at the start of a campaign and saved with it. Only changes between months, so the worker stage reads it freely.
+    int32 CampaignSeed = 0;
+
+    // Changes to ActiveSongs and SimSongs, deferred while a month step is in flight.
+    FSimulationCommandQueue Commands;
+
+    // Calendar events for songs waiting on a scheduled release.
+    TMap<TWeakObjectPtr<USong>, FCalendarEventHandle> PendingReleases;
+
     // Songs that have fallen out of relevance / archived.
     UPROPERTY()
     TArray<TObjectPtr<USong>> ArchivedSongs;
 
-    // Internal helper to update popularity and chart stats.
-    void UpdateSongForNewMonth(USong* Song);
+    void HandleMonthBegun(const FGameMonth& PendingMonth);
+
+    // Adds a song to both the UObject and the simulated view.
+    void AddActiveSong(USong* Song);
+
+    // Moves songs that fell below the relevance threshold to the archive, keeping SimSongs aligned.
+    void ArchiveFadedSongs();
+
+    // Sorts SimSongs indices by popularity into OutOrder; safe to call from the worker.
+    void RankSimSongs(TArray<int32>& OutOrder) const;
+
+    void PublishChart(const FGameMonth& Month, const TArray<int32>& Order);
 
-    // Internal helper to move a song to archive.
-    void ArchiveSong(USong* Song);
+    // Hands this month's chart entries and a new #1 to the news generator. Call before PublishChart.
+    void SubmitChartNews(const TArray<int32>& Order);
 };
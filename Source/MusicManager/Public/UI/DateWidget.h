@@ -28,6 +28,11 @@ protected:
     UPROPERTY(meta = (BindWidgetOptional))
     UImage* DateImage;
 
-    UFUNCTION()
-    void HandleMonthAdvanced(const FDateTime& NewDate);
+    /** UI phase stage of the month pipeline. */
+    bool HandleMonthAdvanced(const FGameMonth& NewMonth, int32& Cursor, double DeadlineSeconds);
+
+    void DisplayMonth(const FGameMonth& DisplayedMonth);
+
+private:
+    FDelegateHandle MonthStageHandle;
 };
@@ -24,6 +24,9 @@ public:
 private:
     FArtistData LocalArtistData;
 
+    /** False until the first SetupItem, so a new row always fills in its text. */
+    bool bHasArtistData = false;
+
 protected:
     UFUNCTION()
     void HandleClicked();
@@ -2,25 +2,40 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/UserWidgetPool.h"
 #include "AuditionTypes.h"
+#include "SignedRosterSnapshot.h"
 #include "SignedArtistPanelWidget.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnArtistFromPanelSelected, FString, ArtistId);
 
+/**
+ * Scrollable list of the label's signed artists.
+ *
+ * Rows are keyed by artist name, the id the rest of the UI uses for an artist. A new roster updates the rows of
+ * artists already shown in place, creates rows only for newly signed artists and hands the rows of artists no
+ * longer signed back to a pool, so signing one artist onto a long roster costs one row rather than a rebuild.
+ */
 UCLASS()
 class MUSICMANAGER_API USignedArtistPanelWidget : public UUserWidget
 {
     GENERATED_BODY()
 
 public:
+    USignedArtistPanelWidget(const FObjectInitializer& ObjectInitializer);
+
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
 
     UPROPERTY(BlueprintAssignable)
     FOnArtistFromPanelSelected OnArtistSelected;
 
     void PopulateArtistList(const TArray<FArtistData>& SignedArtists);
 
+    /** Brings the list in line with a shared roster snapshot, skipping versions that are already displayed. */
+    void PopulateArtistList(const FSignedRosterSnapshotRef& Roster);
+
 protected:
     UFUNCTION()
     void HandleArtistItemClicked(FString ArtistId);
@@ -31,5 +46,18 @@ protected:
     UPROPERTY(EditAnywhere, Category="UI")
     TSubclassOf<class USignedArtistItemWidget> ItemClass;
 
-    TArray<TWeakObjectPtr<USignedArtistItemWidget>> SpawnedItems;
+    /** Rows in the scroll box by artist name. */
+    UPROPERTY(Transient)
+    TMap<FString, TObjectPtr<USignedArtistItemWidget>> ItemsByArtist;
+
+    /** Rows of artists that left the roster, kept for the next ones to be signed. */
+    UPROPERTY(Transient)
+    FUserWidgetPool ItemPool;
+
+    /** Roster currently shown; holding it keeps the displayed data alive without a copy. */
+    FSignedRosterSnapshotPtr DisplayedRoster;
+
+private:
+    USignedArtistItemWidget* AcquireItem();
+    void ReleaseItem(USignedArtistItemWidget* Item);
 };
@@ -5,13 +5,13 @@
 #include "AuditionTypes.h"
 #include "EventSubsystem.h"
 #include "FArtistContract.h"
-#include "Async/Async.h"
+#include "GameThreadCommandQueue.h"
 #include "Templates/UnrealTemplate.h"
 #include "UIManagerSubsystem.generated.h"
 
 class ULayout;
 
-DECLARE_MULTICAST_DELEGATE_OneParam(FOnNewsSelected, const FMusicNewsEvent&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNewsSelected, FNewsHandle);
 
 /**
  * Game-instance subsystem that orchestrates high-level UI interactions and ensures they run on the game thread.
@@ -50,7 +50,7 @@ public:
     /** Handle selection events coming from news cards. */
 
     UFUNCTION()
-    void HandleNewsCardSelected(const FMusicNewsEvent& EventData);
+    void HandleNewsCardSelected(FNewsHandle News);
 
     UFUNCTION()
     void HandleArtistSigned(const FArtistContract& Contract);
@@ -71,6 +71,7 @@ private:
     /** Weak pointer to the active layout to avoid ownership over widgets. */
     TWeakObjectPtr<ULayout> ActiveLayout;
 
+    /** Runs Lambda now on the game thread, otherwise queues it for the next drain of the game-thread command queue. */
     template<typename Func>
     void ExecuteOnGameThread(Func&& Lambda)
     {
@@ -80,7 +81,7 @@ private:
             return;
         }
 
-        AsyncTask(ENamedThreads::GameThread, [CapturedLambda = Forward<Func>(Lambda)]()
+        FGameThreadCommandQueue::Get().Enqueue(this, [CapturedLambda = Forward<Func>(Lambda)](UUIManagerSubsystem&) mutable
         {
             CapturedLambda();
         });